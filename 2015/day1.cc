@@ -43,13 +43,13 @@ What is the position of the character that causes Santa to first enter the
 basement?
 */
 
-#include <iostream>
+#include <cassert>
 #include <optional>
-#include <string>
-#include <vector>
+#include <string_view>
 
-#include "absl/strings/str_join.h"
-#include "utils/utils.h"
+#include "utils/day.h"
+
+namespace {
 
 struct FloorInfo {
   int final_floor = 0;
@@ -73,13 +73,7 @@ FloorInfo CountFloors(std::string_view input) {
   return info;
 }
 
-int main() {
-  std::string input = aoc::ReadFileToString("./2015/day1.txt");
-  std::vector<std::string> v = {"foo", "bar", "baz"};
-  std::string s = absl::StrJoin(v, "-");
-
-  std::cout << "Joined string: " << s << "\n";
-
+void Examples() {
   assert(CountFloors("(())").final_floor == 0);
   assert(CountFloors("(()))").first_basement_position == 5);
   assert(CountFloors("()()").final_floor == 0);
@@ -88,12 +82,21 @@ int main() {
   assert(CountFloors("(()(()(").final_floor == 3);
   assert(CountFloors(")())())").final_floor == -3);
   assert(CountFloors(")())())").first_basement_position == 1);
+}
 
-  FloorInfo info = CountFloors(input);
-  std::cout << "floor = " << info.final_floor << std::endl;
-  if (info.first_basement_position) {
-    std::cout << "first basement position = " << *info.first_basement_position
-              << std::endl;
-  }
-  return 0;
+// The floors are counted straight from the input, so there is nothing to parse.
+std::string_view Parse(std::string_view input) { return input; }
+
+int Part1(std::string_view input) { return CountFloors(input).final_floor; }
+
+std::optional<int> Part2(std::string_view input) {
+  return CountFloors(input).first_basement_position;
 }
+
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2015,
+                  .day = 1,
+                  .input_file = "./2015/day1.txt",
+                  .examples = Examples},
+                 Parse, Part1, Part2);
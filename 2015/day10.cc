@@ -34,9 +34,14 @@ times. What is the length of the new result?
 */
 
 #include <cassert>
-#include <iostream>
+#include <string>
+#include <string_view>
 
-using std::string, std::cout, std::to_string, std::endl;
+#include "utils/day.h"
+
+namespace {
+
+using std::string, std::to_string;
 
 string GetNextSequence(const string& current_sequence) {
   string new_sequence = "";
@@ -66,9 +71,7 @@ string GetNextSequence(const string& current_sequence) {
   return new_sequence;
 }
 
-int main() {
-  string sequence = "3113322113";
-
+void Examples() {
   assert(GetNextSequence("1") == "11");
   assert(GetNextSequence("11") == "21");
   assert(GetNextSequence("21") == "1211");
@@ -81,20 +84,25 @@ int main() {
   }
 
   assert(test == "312211");
+}
 
-  for (int i = 0; i < 40; i++) {
+string Parse(std::string_view input) { return string(input); }
+
+size_t LengthAfter(string sequence, int repetitions) {
+  for (int i = 0; i < repetitions; i++) {
     sequence = GetNextSequence(sequence);
   }
+  return sequence.length();
+}
 
-  cout << "The final sequence length after 40 repititions is: "
-       << sequence.length() << endl;
+size_t Part1(const string& sequence) { return LengthAfter(sequence, 40); }
 
-  for (int i = 0; i < 10; i++) {
-    sequence = GetNextSequence(sequence);
-  }
+size_t Part2(const string& sequence) { return LengthAfter(sequence, 50); }
 
-  cout << "The final sequence length after 50 repititions is: "
-       << sequence.length() << endl;
+}  // namespace
 
-  return 0;
-}
\ No newline at end of file
+AOC_REGISTER_DAY({.year = 2015,
+                  .day = 10,
+                  .input_literal = "3113322113",
+                  .examples = Examples},
+                 Parse, Part1, Part2);
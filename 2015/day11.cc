@@ -40,9 +40,14 @@ Santa's password expired again. What's the next one?
 */
 
 #include <cassert>
-#include <iostream>
+#include <string>
+#include <string_view>
 
-using std::cout, std::endl, std::string;
+#include "utils/day.h"
+
+namespace {
+
+using std::string;
 
 string IncrementString(string str) {
   int n = str.size();
@@ -145,8 +150,7 @@ string FindNextValidPassword(string str) {
   return str;
 }
 
-int main() {
-  string initial_password = "hxbxwxba";
+void Examples() {
   assert(IncrementString("abc") == "abd");
   assert(IncrementString("azz") == "baa");
   assert(IncrementString("zzz") == "aaaa");
@@ -168,16 +172,22 @@ int main() {
 
   assert(FindNextValidPassword("abcdefgh") == "abcdffaa");
   assert(FindNextValidPassword("ghijklmn") == "ghjaabcc");
+}
 
-  string next_password = FindNextValidPassword(initial_password);
+string Parse(std::string_view input) { return string(input); }
 
-  cout << "The next valid password after " << initial_password << ": "
-       << next_password << endl;
+string Part1(const string& initial_password) {
+  return FindNextValidPassword(initial_password);
+}
+
+string Part2(const string& initial_password) {
+  return FindNextValidPassword(FindNextValidPassword(initial_password));
+}
 
-  initial_password = next_password;
-  next_password = FindNextValidPassword(initial_password);
+}  // namespace
 
-  cout << "The next valid password after " << initial_password << ": "
-       << next_password << endl;
-  return 0;
-}
\ No newline at end of file
+AOC_REGISTER_DAY({.year = 2015,
+                  .day = 11,
+                  .input_literal = "hxbxwxba",
+                  .examples = Examples},
+                 Parse, Part1, Part2);
@@ -32,12 +32,14 @@ ignored.
 is ignored. [1,"red",5] has a sum of 6, because "red" in an array has no effect.
 */
 
-#include <iostream>
 #include <nlohmann/json.hpp>
 #include <regex>
 #include <string>
+#include <string_view>
 
-#include "utils/utils.h"
+#include "utils/day.h"
+
+namespace {
 
 using json = nlohmann::json;
 
@@ -71,34 +73,36 @@ void IterateJson(const json& j, int& sum) {
 }
 
 // Function to calculate the sum of all numbers in a string using std::regex
-int SumOfNumbers(const std::string& input) {
+int SumOfNumbers(std::string_view input) {
   std::regex number_pattern(R"(-?\d+)");
-  std::sregex_iterator current_match(input.begin(), input.end(),
+  std::cregex_iterator current_match(input.data(), input.data() + input.size(),
                                      number_pattern);
-  std::sregex_iterator last_match;
+  std::cregex_iterator last_match;
 
   int sum = 0;
 
   while (current_match != last_match) {
-    std::smatch match = *current_match;
+    std::cmatch match = *current_match;
     sum += std::stoi(match.str());
     current_match++;
   }
   return sum;
 }
 
-int main() {
-  std::string input = aoc::ReadFileToString("./2015/day12.txt");
+std::string_view Parse(std::string_view input) { return input; }
 
-  std::cout << "The sum of all the numbers is: " << SumOfNumbers(input)
-            << std::endl;
+int Part1(std::string_view input) { return SumOfNumbers(input); }
 
-  json json_object = json::parse(input);
+int Part2(std::string_view input) {
+  json json_object = json::parse(input.begin(), input.end());
 
   int sum = 0;
 
   IterateJson(json_object, sum);
-
-  std::cout << "The sum of all the valid numbers (part 2) is: " << sum
-            << std::endl;
+  return sum;
 }
+
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2015, .day = 12, .input_file = "./2015/day12.txt"},
+                 Parse, Part1, Part2);
@@ -0,0 +1,53 @@
+// Generates 2015 day 12 inputs: one JSON document of about --size values,
+// nesting arrays and objects whose values are numbers and colors, "red" among
+// them.
+
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+
+#include "utils/gen.h"
+
+namespace {
+
+constexpr int kMaxDepth = 8;
+constexpr std::string_view kColors[] = {"red",    "green",  "blue",
+                                        "yellow", "orange", "violet"};
+
+// Writes one value, spending `budget` on it and anything nested inside.
+void WriteValue(aoc::Generator& gen, int depth, int64_t& budget) {
+  --budget;
+  const int64_t roll = gen.Uniform(0, 9);
+  if (depth < kMaxDepth && budget > 0 && roll < 3) {
+    const bool object = roll == 0;
+    gen.Write(object ? '{' : '[');
+    const int64_t length = gen.Uniform(1, 8);
+    for (int64_t i = 0; i < length && budget > 0; ++i) {
+      if (i > 0) gen.Write(',');
+      if (object) gen.Print("\"{}\":", static_cast<char>('a' + i));
+      WriteValue(gen, depth + 1, budget);
+    }
+    gen.Write(object ? '}' : ']');
+  } else if (roll < 8) {
+    gen.Print("{}", gen.Uniform(-50, 200));
+  } else {
+    gen.Print("\"{}\"", kColors[gen.Uniform(0, std::size(kColors) - 1)]);
+  }
+}
+
+void Generate(aoc::Generator& gen) {
+  // The outermost value is always a container, however small --size is.
+  gen.Write('[');
+  for (int64_t budget = gen.size(), i = 0; budget > 0; ++i) {
+    if (i > 0) gen.Write(',');
+    WriteValue(gen, 1, budget);
+  }
+  gen.Write("]\n");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  return aoc::RunGenerator(
+      argc, argv, {.default_size = 5000, .size_unit = "values"}, Generate);
+}
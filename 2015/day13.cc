@@ -47,24 +47,18 @@ actual guest list?
 */
 
 #include <algorithm>
-#include <iostream>
-#include <regex>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
+#include "absl/log/check.h"
+#include "utils/day.h"
+#include "utils/interner.h"
+#include "utils/scan.h"
 #include "utils/utils.h"
 
-int NameToNode(const std::string& name, std::vector<std::string>& names) {
-  // If we have seen the name, return its idx.
-  auto it = std::find(names.begin(), names.end(), name);
-  if (it != names.end()) {
-    // Return the index.
-    return std::distance(names.begin(), it);
-  }
-  names.push_back(name);
-  return names.size() - 1;
-}
+namespace {
 
 void AddValueToMatrix(std::vector<std::vector<int>>& matrix, int from_node,
                       int to_node, int value) {
@@ -78,28 +72,26 @@ void AddValueToMatrix(std::vector<std::vector<int>>& matrix, int from_node,
   matrix[from_node][to_node] = value;
 }
 
-std::vector<std::vector<int>> BuildMatrix(std::vector<std::string> lines) {
-  constexpr int kFromIdx = 1;
-  constexpr int kToIdx = 4;
-  constexpr int kSignIdx = 2;
-  constexpr int kValueIdx = 3;
-
+std::vector<std::vector<int>> BuildMatrix(
+    const std::vector<std::string>& lines) {
   std::vector<std::vector<int>> matrix;
 
   // All the names we have seen so far.
-  std::vector<std::string> names;
+  aoc::Interner names;
 
-  std::regex number_pattern(
-      R"((\w+) would (\w+) (\d+) happiness units by sitting next to (\w+).)");
   for (const auto& line : lines) {
-    std::smatch match;
-    std::regex_search(line, match, number_pattern);
-
-    int from_node = NameToNode(match[kFromIdx], names);
-    int to_node = NameToNode(match[kToIdx], names);
-
-    AddValueToMatrix(matrix, from_node, to_node, std::stoi(match[kValueIdx]));
-    if (match[kSignIdx] == "lose") {
+    auto match =
+        aoc::Scan<"{} would {} {} happiness units by sitting next to {}.",
+                  std::string_view, std::string_view, int, std::string_view>(
+            line);
+    CHECK(match.has_value()) << "Bad line: " << line;
+    auto [from, sign, value, to] = *match;
+
+    int from_node = names.Intern(from);
+    int to_node = names.Intern(to);
+
+    AddValueToMatrix(matrix, from_node, to_node, value);
+    if (sign == "lose") {
       matrix[from_node][to_node] *= -1;
     }
   }
@@ -109,25 +101,16 @@ std::vector<std::vector<int>> BuildMatrix(std::vector<std::string> lines) {
 // Function to pretty print a 2D vector
 void PrettyPrint(const std::vector<std::vector<int>>& matrix) {
   for (const auto& row : matrix) {
-    std::cout << "[ ";
-    for (const auto& elem : row) {
-      std::cout << elem << " ";
-    }
-    std::cout << "]" << std::endl;
+    AOC_LOG(DEBUG, "{}", row);
   }
 }
 
 void PrettyPrint(const std::vector<int>& vec, int happiness) {
-  std::cout << "[ ";
-  for (const auto& elem : vec) {
-    std::cout << elem << " ";
-  }
-  std::cout << "] -> " << happiness << std::endl;
+  AOC_LOG(DEBUG, "{} -> {}", vec, happiness);
 }
 
 int ComputeHappiness(const std::vector<int>& table,
-                     const std::vector<std::vector<int>>& matrix,
-                     bool print = false) {
+                     const std::vector<std::vector<int>>& matrix) {
   int happiness = 0;
   for (int person_idx = 0; person_idx < table.size(); ++person_idx) {
     // For each person, add the happiness from their left & right table partner.
@@ -143,10 +126,8 @@ int ComputeHappiness(const std::vector<int>& table,
     int person = table[person_idx];
     happiness += matrix[person][left_neighbor];
     happiness += matrix[person][right_neighbor];
-    if (print)
-      std::cout << "Person: " << person
-                << " Left: " << matrix[person][left_neighbor]
-                << " Right: " << matrix[person][right_neighbor] << "\n";
+    AOC_LOG(TRACE, "Person: {} Left: {} Right: {}", person,
+            matrix[person][left_neighbor], matrix[person][right_neighbor]);
   }
   // PrettyPrint(table, happiness);
   return happiness;
@@ -181,14 +162,13 @@ void FindMaxHappiness(const std::vector<std::vector<int>>& matrix,
   }
 }
 
-int main() {
-  std::vector<std::string> lines =
-      aoc::LoadStringsFromFileByLine("./2015/day13.txt");
-
-  std::vector<std::vector<int>> matrix = BuildMatrix(lines);
+using Matrix = std::vector<std::vector<int>>;
 
-  // PrettyPrint(matrix);
+Matrix Parse(std::string_view input) {
+  return BuildMatrix(aoc::SplitLines(input));
+}
 
+int MaxHappiness(const Matrix& matrix) {
   std::vector<int> table(matrix.size());
 
   // Force person 0 to position 0.
@@ -199,23 +179,23 @@ int main() {
   // Starting position is 1, since we force person 0 to seat 0.
   constexpr int kStartingPosition = 1;
   FindMaxHappiness(matrix, table, kStartingPosition, happiness);
+  return happiness;
+}
+
+int Part1(const Matrix& matrix) { return MaxHappiness(matrix); }
 
+int Part2(const Matrix& parsed) {
   // Update the matrix to include the neutral person.
+  Matrix matrix = parsed;
   // Add a row of zeroes.
   matrix.push_back(std::vector<int>(matrix.front().size(), 0));
   // add a column of zeroes.
   std::for_each(matrix.begin(), matrix.end(),
                 [](auto& row) { row.push_back(0); });
-  // Add a seat at the table.
-  table.push_back(0);
-  int new_happiness = 0;
-  FindMaxHappiness(matrix, table, kStartingPosition, new_happiness);
-
-  std::cout << "Max happiness: " << happiness << std::endl;
-
-  // PrettyPrint(matrix);
+  return MaxHappiness(matrix);
+}
 
-  std::cout << "New max happiness: " << new_happiness << std::endl;
+}  // namespace
 
-  return 0;
-}
+AOC_REGISTER_DAY({.year = 2015, .day = 13, .input_file = "./2015/day13.txt"},
+                 Parse, Part1, Part2);
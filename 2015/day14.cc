@@ -25,15 +25,17 @@ So, in this situation, Comet would win (if the race ended at 1000 seconds).
 Given the descriptions of each reindeer (in your puzzle input), after exactly
 2503 seconds, what distance has the winning reindeer traveled?
 */
-#include <print>
-
-#include <iostream>
-#include <regex>
+#include <algorithm>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include "utils/day.h"
+#include "utils/extract_ints.h"
 #include "utils/utils.h"
 
+namespace {
+
 struct Reindeer {
   std::string name;
   int rate_km_per_s = 0;
@@ -48,29 +50,21 @@ struct Reindeer {
   int CycleDistance() const { return rate_km_per_s * run_duration_s; }
 };
 
-std::vector<Reindeer> GetReindeer(std::vector<std::string> lines) {
-  constexpr int kNameIdx = 1;
-  constexpr int kRateIdx = 2;
-  constexpr int kRunDurationIdx = 3;
-  constexpr int kRestDurationIdx = 4;
-
+std::vector<Reindeer> GetReindeer(const std::vector<std::string>& lines) {
   // All the names we have seen so far.
   std::vector<Reindeer> reindeer;
 
-  std::regex pattern(
-      R"((\w+) can fly (\d+) km/s for (\d+) seconds, but then must rest for (\d+) seconds.)");
-  for (const auto& line : lines) {
-    std::smatch match;
-    std::regex_search(line, match, pattern);
-
-    std::cout << match[kNameIdx] << " " << match[kRateIdx] << " "
-              << match[kRunDurationIdx] << " " << match[kRestDurationIdx]
-              << std::endl;
-    reindeer.push_back(
-        Reindeer{.name = match[kNameIdx],
-                 .rate_km_per_s = std::stoi(match[kRateIdx]),
-                 .run_duration_s = std::stoi(match[kRunDurationIdx]),
-                 .rest_duration_s = std::stoi(match[kRestDurationIdx])});
+  // "Comet can fly 14 km/s for 10 seconds, but then must rest for 127
+  // seconds."
+  for (std::string_view line : lines) {
+    std::string_view name = line.substr(0, line.find(' '));
+    auto [rate, run_duration, rest_duration] = aoc::ExtractInts<3, int>(line);
+
+    AOC_LOG(DEBUG, "{} {} {} {}", name, rate, run_duration, rest_duration);
+    reindeer.push_back(Reindeer{.name = std::string(name),
+                                .rate_km_per_s = rate,
+                                .run_duration_s = run_duration,
+                                .rest_duration_s = rest_duration});
   }
   return reindeer;
 }
@@ -91,30 +85,48 @@ int ComputeDistAfterTime(const Reindeer& r, int time_s) {
 
   return dist;
 }
-int main() {
-  std::vector<std::string> lines =
-      aoc::LoadStringsFromFileByLine("./2015/day14.txt");
-  std::vector<Reindeer> reindeer = GetReindeer(lines);
-  constexpr int kRaceDuration = 2503;
-  // constexpr int kRaceDuration = 10;
+
+constexpr int kRaceDuration = 2503;
+
+std::vector<Reindeer> Parse(std::string_view input) {
+  return GetReindeer(aoc::SplitLines(input));
+}
+
+int Part1(const std::vector<Reindeer>& reindeer) {
+  int max_dist = 0;
+  for (const auto& r : reindeer) {
+    max_dist = std::max(ComputeDistAfterTime(r, kRaceDuration), max_dist);
+  }
+  return max_dist;
+}
+
+int Part2(const std::vector<Reindeer>& parsed) {
+  std::vector<Reindeer> reindeer = parsed;
   for (int i = 1; i <= kRaceDuration; ++i) {
     int max_dist = 0;
     for (auto& r : reindeer) {
       r.current_dist = ComputeDistAfterTime(r, i);
       max_dist = std::max(r.current_dist, max_dist);
-      std::print("At {}, {} is at distance {}!\n", i, r.name, r.current_dist);
-      // std::cout << "Time: "
+      AOC_LOG(TRACE, "At {}, {} is at distance {}!", i, r.name,
+              r.current_dist);
     }
     std::for_each(reindeer.begin(), reindeer.end(), [max_dist](Reindeer& r) {
       if (r.current_dist == max_dist) {
         r.AwardPoint();
-        std::print("Point awarded to {}! New total: {}.\n", r.name,
-                   r.point_total);
+        AOC_LOG(TRACE, "Point awarded to {}! New total: {}.", r.name,
+                r.point_total);
       }
     });
   }
-  for (auto& r : reindeer) {
-    std::cout << r.name << " points: " << r.point_total << std::endl;
+  int max_points = 0;
+  for (const auto& r : reindeer) {
+    AOC_LOG(DEBUG, "{} points: {}", r.name, r.point_total);
+    max_points = std::max(r.point_total, max_points);
   }
-  return 0;
+  return max_points;
 }
+
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2015, .day = 14, .input_file = "./2015/day14.txt"},
+                 Parse, Part1, Part2);
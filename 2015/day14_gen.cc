@@ -0,0 +1,36 @@
+// Generates 2015 day 14 inputs: --size reindeer with made-up names, speeds,
+// flight times and rest times.
+
+#include <cstdint>
+#include <string>
+
+#include "utils/gen.h"
+
+namespace {
+
+// A distinct name for each `index`, with no digits for the day's number
+// extraction to trip over: Ra, Rb, ..., Rz, Rba, ...
+std::string Name(int64_t index) {
+  std::string suffix;
+  do {
+    suffix.insert(suffix.begin(), static_cast<char>('a' + index % 26));
+    index /= 26;
+  } while (index > 0);
+  return "R" + suffix;
+}
+
+void Generate(aoc::Generator& gen) {
+  for (int64_t i = 0; i < gen.size(); ++i) {
+    gen.Print(
+        "{} can fly {} km/s for {} seconds, but then must rest for {} "
+        "seconds.\n",
+        Name(i), gen.Uniform(2, 30), gen.Uniform(2, 20), gen.Uniform(20, 200));
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  return aoc::RunGenerator(
+      argc, argv, {.default_size = 9, .size_unit = "reindeer"}, Generate);
+}
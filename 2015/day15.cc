@@ -58,14 +58,19 @@ Given the ingredients in your kitchen and their properties, what is the total
 score of the highest-scoring cookie you can make with a calorie total of 500?
 */
 
-#include <print>
-
+#include <algorithm>
 #include <cassert>
-#include <regex>
+#include <print>
+#include <string>
+#include <string_view>
 #include <vector>
 
+#include "utils/day.h"
+#include "utils/extract_ints.h"
 #include "utils/utils.h"
 
+namespace {
+
 struct Ingredient {
   std::string name;
   int capacity = 0;
@@ -80,32 +85,24 @@ struct IngredientAmount {
   int tsp;
 };
 
-std::vector<IngredientAmount> GetIngredients(std::vector<std::string> lines) {
-  constexpr int kNameIdx = 1;
-  constexpr int kCapacityIdx = 2;
-  constexpr int kDurabilityIdx = 3;
-  constexpr int kFlavorIdx = 4;
-  constexpr int kTextureIdx = 5;
-  constexpr int kCalories = 6;
-
+std::vector<IngredientAmount> GetIngredients(
+    const std::vector<std::string>& lines) {
   // All the names we have seen so far.
   std::vector<IngredientAmount> recipe;
-  std::regex pattern(
-      R"((\w+): capacity (-?\d+), durability (-?\d+), flavor (-?\d+), texture (-?\d+), calories (-?\d+))");
-
-  for (const auto& line : lines) {
-    std::smatch match;
-    std::regex_search(line, match, pattern);
-
-    recipe.push_back(
-        {.ingredient =
-             Ingredient{.name = match[kNameIdx],
-                        .capacity = std::stoi(match[kCapacityIdx]),
-                        .durability = std::stoi(match[kDurabilityIdx]),
-                        .flavor = std::stoi(match[kFlavorIdx]),
-                        .texture = std::stoi(match[kTextureIdx]),
-                        .calories = std::stoi(match[kCalories])},
-         .tsp = 1});
+
+  // "Butterscotch: capacity -1, durability -2, flavor 6, texture 3, calories 8"
+  for (std::string_view line : lines) {
+    std::string_view name = line.substr(0, line.find(':'));
+    auto [capacity, durability, flavor, texture, calories] =
+        aoc::ExtractInts<5, int>(line);
+
+    recipe.push_back({.ingredient = Ingredient{.name = std::string(name),
+                                               .capacity = capacity,
+                                               .durability = durability,
+                                               .flavor = flavor,
+                                               .texture = texture,
+                                               .calories = calories},
+                      .tsp = 1});
   }
   return recipe;
 }
@@ -198,8 +195,8 @@ int GetTheNastyHealthyMilkDunkingCookieRecipeScore(
         int old_score = best_score;
         best_score = std::max(best_score, CalculateScore(recipe, true));
         if (best_score != old_score) {
-          std::print("Found a new best score {}: {}, {}, {}, {}\n", best_score,
-                     i, j, k, l);
+          AOC_LOG(DEBUG, "Found a new best score {}: {}, {}, {}, {}",
+                  best_score, i, j, k, l);
         }
       }
     }
@@ -237,23 +234,22 @@ void TheTest() {
   TestCalculateScore();
 }
 
-int main() {
-  std::vector<std::string> lines =
-      aoc::LoadStringsFromFileByLine("./2015/day15.txt");
-  std::vector<IngredientAmount> recipe = GetIngredients(lines);
-
-  // TheTest();
+std::vector<IngredientAmount> Parse(std::string_view input) {
+  return GetIngredients(aoc::SplitLines(input));
+}
 
+int Part1(const std::vector<IngredientAmount>& ingredients) {
+  std::vector<IngredientAmount> recipe = ingredients;
   MakeThePerfectMilkDunkingCookieRecipe(recipe);
-  int score = CalculateScore(recipe);
-
-  std::print("The score for the perfect milk dunking cookie recipe is {}\n",
-             score);
+  return CalculateScore(recipe);
+}
 
-  int new_score = GetTheNastyHealthyMilkDunkingCookieRecipeScore(recipe);
+int Part2(const std::vector<IngredientAmount>& ingredients) {
+  std::vector<IngredientAmount> recipe = ingredients;
+  return GetTheNastyHealthyMilkDunkingCookieRecipeScore(recipe);
+}
 
-  std::print("The new healthy nasty milk dunking cookie recipe score is {}\n",
-             new_score);
+}  // namespace
 
-  return 0;
-}
+AOC_REGISTER_DAY({.year = 2015, .day = 15, .input_file = "./2015/day15.txt"},
+                 Parse, Part1, Part2);
@@ -1,64 +1,101 @@
+#include <algorithm>
+#include <array>
+#include <optional>
 #include <print>
-
-#include <regex>
-#include <unordered_map>
+#include <string>
+#include <string_view>
 #include <vector>
 
+#include "absl/log/check.h"
+#include "utils/day.h"
+#include "utils/interner.h"
+#include "utils/scan.h"
 #include "utils/utils.h"
 
+namespace {
+
+constexpr int kNumClues = 10;
+
+// Every thing the MFCSAM can detect. A clue's id is its index here.
+constexpr std::array<std::string_view, kNumClues> kClueNames = {
+    "children", "cats",    "samoyeds", "pomeranians", "akitas",
+    "vizslas",  "goldfish", "trees",   "cars",        "perfumes"};
+
+// What the MFCSAM says about the aunt who sent the gift, by clue id.
+constexpr std::array<int, kNumClues> kMysteryAunt = {3, 7, 2, 3, 0,
+                                                     0, 5, 3, 2, 1};
+
+// Clue counts by clue id, or kUnknown for clues we don't remember.
+constexpr int kUnknown = -1;
+using Aunt = std::array<int, kNumClues>;
+
+// The clue names never change, so they are looked up with a perfect hash.
+const aoc::Interner& ClueIds() {
+  static const aoc::Interner* const clue_ids = [] {
+    auto* clue_ids = new aoc::Interner;
+    for (std::string_view name : kClueNames) {
+      clue_ids->Intern(name);
+    }
+    clue_ids->Freeze();
+    return clue_ids;
+  }();
+  return *clue_ids;
+}
+
+int ClueId(std::string_view name) {
+  std::optional<int> id = ClueIds().Find(name);
+  CHECK(id.has_value()) << "Unknown clue: " << name;
+  return *id;
+}
+
 // Pretty print function for aunt_clues
-void PrintAuntClues(
-    const std::vector<std::unordered_map<std::string, int>>& aunt_clues) {
+void PrintAuntClues(const std::vector<Aunt>& aunt_clues) {
   int aunt_number = 1;
   for (const auto& aunt : aunt_clues) {
     std::print("Aunt {}: {{", aunt_number);
-    for (auto it = aunt.begin(); it != aunt.end(); ++it) {
-      std::print("{}: {}", it->first, it->second);
-      if (std::next(it) != aunt.end()) {
-        std::print(", ");
+    bool first = true;
+    for (int clue = 0; clue < kNumClues; ++clue) {
+      if (aunt[clue] == kUnknown) {
+        continue;
       }
+      std::print("{}{}: {}", first ? "" : ", ", kClueNames[clue], aunt[clue]);
+      first = false;
     }
     std::print("}}\n");
     aunt_number++;
   }
 }
 
-std::vector<std::unordered_map<std::string, int>> GetAuntClues(
-    const std::vector<std::string>& lines) {
-  std::vector<std::unordered_map<std::string, int>> aunt_clues;
-  std::regex pattern(R"(\w+ \d+: (\w+): (\d+), (\w+): (\d+), (\w+): (\d+))");
-
+std::vector<Aunt> GetAuntClues(const std::vector<std::string>& lines) {
+  std::vector<Aunt> aunt_clues;
   for (const auto& line : lines) {
-    std::unordered_map<std::string, int> current_aunt;
-    std::smatch match;
-    std::regex_search(line, match, pattern);
-
-    for (int i = 1; i <= 6; i += 2) {
-      current_aunt.insert(
-          std::pair<std::string, int>(match[i], std::stoi(match[i + 1])));
-    }
+    Aunt current_aunt;
+    current_aunt.fill(kUnknown);
+    // "Sue 1: cars: 9, akitas: 3, goldfish: 0". Aunts are numbered in order,
+    // so only the clues after the first ": " matter.
+    std::string_view clues = line;
+    clues.remove_prefix(std::min(clues.size(), clues.find(": ") + 2));
+    auto match = aoc::Scan<"{}: {}, {}: {}, {}: {}", std::string_view, int,
+                           std::string_view, int, std::string_view, int>(
+        clues);
+    CHECK(match.has_value()) << "Bad line: " << line;
+    auto [clue1, count1, clue2, count2, clue3, count3] = *match;
+
+    current_aunt[ClueId(clue1)] = count1;
+    current_aunt[ClueId(clue2)] = count2;
+    current_aunt[ClueId(clue3)] = count3;
     aunt_clues.push_back(current_aunt);
   }
   return aunt_clues;
 }
 
 int HireSherlockHolmesToDeduceWhichAuntMyGiftIsFrom(
-    const std::vector<std::unordered_map<std::string, int>>& aunt_clues) {
-  const std::vector<std::string> clues = {
-      "children", "cats",     "samoyeds", "pomeranians", "akitas",
-      "vizslas",  "goldfish", "trees",    "cars",        "perfumes"};
-  const std::unordered_map<std::string, int> mystery_aunt = {
-      {"children", 3}, {"cats", 7},    {"samoyeds", 2}, {"pomeranians", 3},
-      {"akitas", 0},   {"vizslas", 0}, {"goldfish", 5}, {"trees", 3},
-      {"cars", 2},     {"perfumes", 1}};
-
+    const std::vector<Aunt>& aunt_clues) {
   for (int i = 0; i < aunt_clues.size(); i++) {
     int match_level = 0;
-    for (auto clue : clues) {
-      if (aunt_clues[i].find(clue) != aunt_clues[i].end()) {
-        if (aunt_clues[i].at(clue) == mystery_aunt.at(clue)) {
-          match_level++;
-        }
+    for (int clue = 0; clue < kNumClues; ++clue) {
+      if (aunt_clues[i][clue] == kMysteryAunt[clue]) {
+        match_level++;
       }
       if (match_level == 3) {
         return i + 1;
@@ -68,19 +105,18 @@ int HireSherlockHolmesToDeduceWhichAuntMyGiftIsFrom(
   return -1;
 }
 
-bool CheckForMatch(const std::unordered_map<std::string, int>& aunt,
-                   const std::unordered_map<std::string, int>& mystery_aunt,
-                   const std::string& clue) {
-  if (clue == "cats" || clue == "trees") {
-    if (aunt.at(clue) <= mystery_aunt.at(clue)) {
+bool CheckForMatch(const Aunt& aunt, int clue) {
+  std::string_view name = kClueNames[clue];
+  if (name == "cats" || name == "trees") {
+    if (aunt[clue] <= kMysteryAunt[clue]) {
       return false;
     }
-  } else if (clue == "pomeranians" || clue == "goldfish") {
-    if (aunt.at(clue) >= mystery_aunt.at(clue)) {
+  } else if (name == "pomeranians" || name == "goldfish") {
+    if (aunt[clue] >= kMysteryAunt[clue]) {
       return false;
     }
   } else {
-    if (aunt.at(clue) != mystery_aunt.at(clue)) {
+    if (aunt[clue] != kMysteryAunt[clue]) {
       return false;
     }
   }
@@ -88,20 +124,12 @@ bool CheckForMatch(const std::unordered_map<std::string, int>& aunt,
 }
 
 int ProvideSherlockHolmesWithTheNewEvidenceSoHeCanReevaluateTheCase(
-    const std::vector<std::unordered_map<std::string, int>>& aunt_clues) {
-  std::vector<std::string> clues = {
-      "trees",  "children", "cats",     "samoyeds", "pomeranians",
-      "akitas", "vizslas",  "goldfish", "cars",     "perfumes"};
-  const std::unordered_map<std::string, int>& mystery_aunt = {
-      {"children", 3}, {"cats", 7},    {"samoyeds", 2}, {"pomeranians", 3},
-      {"akitas", 0},   {"vizslas", 0}, {"goldfish", 5}, {"trees", 3},
-      {"cars", 2},     {"perfumes", 1}};
-
+    const std::vector<Aunt>& aunt_clues) {
   for (int i = 0; i < aunt_clues.size(); i++) {
     int match_level = 0;
-    for (auto clue : clues) {
-      if (aunt_clues[i].find(clue) != aunt_clues[i].end()) {
-        bool match = CheckForMatch(aunt_clues[i], mystery_aunt, clue);
+    for (int clue = 0; clue < kNumClues; ++clue) {
+      if (aunt_clues[i][clue] != kUnknown) {
+        bool match = CheckForMatch(aunt_clues[i], clue);
         if (match) {
           match_level++;
         }
@@ -114,26 +142,22 @@ int ProvideSherlockHolmesWithTheNewEvidenceSoHeCanReevaluateTheCase(
   return -1;
 }
 
-int main() {
-  const std::vector<std::string> lines =
-      aoc::LoadStringsFromFileByLine("./2015/day16.txt");
-  const std::vector<std::unordered_map<std::string, int>> aunt_clues =
-      GetAuntClues(lines);
-
-  int correct_aunt =
-      HireSherlockHolmesToDeduceWhichAuntMyGiftIsFrom(aunt_clues);
-
-  std::print(
-      "I, Sherlock Holmes have deduced that Aunt Sue {} sent you your awesome "
-      "present!\n",
-      correct_aunt);
-
-  correct_aunt =
-      ProvideSherlockHolmesWithTheNewEvidenceSoHeCanReevaluateTheCase(
-          aunt_clues);
-
-  std::print(
-      "After recieving your email regarding the new evidence, I concluded that "
-      "Aunt Sue {} sent you your present.\n",
-      correct_aunt);
-}
\ No newline at end of file
+using AuntClues = std::vector<Aunt>;
+
+AuntClues Parse(std::string_view input) {
+  return GetAuntClues(aoc::SplitLines(input));
+}
+
+int Part1(const AuntClues& aunt_clues) {
+  return HireSherlockHolmesToDeduceWhichAuntMyGiftIsFrom(aunt_clues);
+}
+
+int Part2(const AuntClues& aunt_clues) {
+  return ProvideSherlockHolmesWithTheNewEvidenceSoHeCanReevaluateTheCase(
+      aunt_clues);
+}
+
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2015, .day = 16, .input_file = "./2015/day16.txt"},
+                 Parse, Part1, Part2);
@@ -0,0 +1,37 @@
+// Generates 2015 day 16 inputs: --size aunts, each with three different
+// clues. The aunt halfway down matches the ticker tape exactly, so both parts
+// have an answer.
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "utils/gen.h"
+
+namespace {
+
+constexpr std::string_view kClues[] = {
+    "children", "cats",     "samoyeds", "pomeranians", "akitas",
+    "vizslas",  "goldfish", "trees",    "cars",        "perfumes"};
+
+void Generate(aoc::Generator& gen) {
+  std::vector<int> clues = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  for (int64_t i = 1; i <= gen.size(); ++i) {
+    if (i == (gen.size() + 1) / 2) {
+      // Exact clues only, so the ranges in part 2 don't matter.
+      gen.Print("Sue {}: children: 3, samoyeds: 2, cars: 2\n", i);
+      continue;
+    }
+    gen.Shuffle(clues);
+    gen.Print("Sue {}: {}: {}, {}: {}, {}: {}\n", i, kClues[clues[0]],
+              gen.Uniform(0, 10), kClues[clues[1]], gen.Uniform(0, 10),
+              kClues[clues[2]], gen.Uniform(0, 10));
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  return aoc::RunGenerator(
+      argc, argv, {.default_size = 500, .size_unit = "aunts"}, Generate);
+}
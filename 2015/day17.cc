@@ -32,14 +32,21 @@ ways to use that many containers, and so the answer there would be 3.
 */
 
 #include <cassert>
-#include <print>
-
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "utils/day.h"
+#include "utils/memo.h"
 #include "utils/utils.h"
 
-std::vector<int> LoadData() {
+namespace {
+
+std::vector<int> Parse(std::string_view input) {
   std::vector<int> jugs;
-  std::vector<std::string> lines =
-      aoc::LoadStringsFromFileByLine("./2015/day17.txt");
+  std::vector<std::string> lines = aoc::SplitLines(input);
 
   for (auto line : lines) {
     jugs.push_back(std::stoi(line));
@@ -47,79 +54,99 @@ std::vector<int> LoadData() {
   return jugs;
 }
 
-void FindJugCombinations(std::vector<int> unused_jugs, int remaining_eggnog,
-                         int used_jugs, int& min_used_jugs,
-                         int& num_of_combinations, bool part2 = false) {
-  if (remaining_eggnog < 0) {
-    return;
-  } else if (remaining_eggnog == 0) {
-    if (!part2) {
-      num_of_combinations++;
-      return;
-    }
-    if (used_jugs == min_used_jugs) {
-      num_of_combinations++;
-      return;
-    } else if (used_jugs < min_used_jugs) {
-      min_used_jugs = used_jugs;
-      num_of_combinations = 1;
-      return;
-    }
+constexpr int kAnyNumberOfJugs = -1;
+
+// (first jug, liters left, jugs left) -> number of combinations.
+using CombinationMemo = aoc::Memo<std::tuple<int, int, int>, int64_t>;
+
+// The number of ways to hold exactly `remaining_eggnog` liters in jugs picked
+// from jugs[first:], using exactly `jugs_left` of them or, with
+// kAnyNumberOfJugs, however many it takes. Many different picks of the early
+// jugs leave the same amount for the later ones, so the counts are memoized.
+int64_t CountJugCombinations(const std::vector<int>& jugs, int first,
+                             int remaining_eggnog, int jugs_left,
+                             CombinationMemo& memo) {
+  if (remaining_eggnog == 0 &&
+      (jugs_left == 0 || jugs_left == kAnyNumberOfJugs)) {
+    return 1;
+  }
+  if (remaining_eggnog <= 0 || jugs_left == 0 || first == jugs.size()) {
+    return 0;
   }
+  return memo.GetOrCompute(
+      {first, remaining_eggnog, jugs_left}, [&](const auto&) {
+        int next_jugs_left =
+            jugs_left == kAnyNumberOfJugs ? kAnyNumberOfJugs : jugs_left - 1;
+        // Either fill jugs[first] or leave it out.
+        return CountJugCombinations(jugs, first + 1,
+                                    remaining_eggnog - jugs[first],
+                                    next_jugs_left, memo) +
+               CountJugCombinations(jugs, first + 1, remaining_eggnog,
+                                    jugs_left, memo);
+      });
+}
+
+// The number of ways to hold `eggnog` liters in any number of jugs.
+int64_t CountAllCombinations(const std::vector<int>& jugs, int eggnog) {
+  CombinationMemo memo;
+  int64_t combinations =
+      CountJugCombinations(jugs, 0, eggnog, kAnyNumberOfJugs, memo);
+  aoc::MemoStats stats = memo.Stats();
+  AOC_LOG(DEBUG, "Combination memo: {} hits, {} misses", stats.hits,
+          stats.misses);
+  return combinations;
+}
 
-  for (int i = 0; i < unused_jugs.size(); i++) {
-    int jug = unused_jugs[i];
-    std::vector<int> next_unused_jugs = unused_jugs;
-    // Remove all jugs to the left since we don't want to repeat the check.
-    next_unused_jugs.erase(next_unused_jugs.begin(),
-                           next_unused_jugs.begin() + i + 1);
-    // Recurse, using one more jug.
-    FindJugCombinations(next_unused_jugs, remaining_eggnog - jug, used_jugs + 1,
-                        min_used_jugs, num_of_combinations, part2);
+// The number of ways to hold `eggnog` liters in as few jugs as possible.
+int64_t CountFewestJugCombinations(const std::vector<int>& jugs, int eggnog) {
+  CombinationMemo memo;
+  for (int used_jugs = 1; used_jugs <= jugs.size(); ++used_jugs) {
+    int64_t combinations =
+        CountJugCombinations(jugs, 0, eggnog, used_jugs, memo);
+    if (combinations > 0) {
+      aoc::MemoStats stats = memo.Stats();
+      AOC_LOG(DEBUG, "Combination memo: {} hits, {} misses", stats.hits,
+              stats.misses);
+      return combinations;
+    }
   }
-  return;
+  return 0;
 }
 
 void TestPart1() {
   std::vector<int> test_values = {20, 15, 10, 5, 5};
-  int num_of_combinations = 0;
-  int min_jugs_used = test_values.size();
-  int used_jugs = 0;
-  FindJugCombinations(test_values, 25, used_jugs, min_jugs_used,
-                      num_of_combinations);
+  int64_t num_of_combinations = CountAllCombinations(test_values, 25);
   assert(num_of_combinations == 4);
   // std::print("Test1: {}\n", num_of_combinations);
 }
 
 void TestPart2() {
   std::vector<int> test_values = {20, 15, 10, 5, 5};
-  int num_of_combinations = 0;
-  int min_used_jugs = test_values.size();
-  int used_jugs = 0;
-  FindJugCombinations(test_values, 25, used_jugs, min_used_jugs,
-                      num_of_combinations, true);
+  int64_t num_of_combinations = CountFewestJugCombinations(test_values, 25);
   // std::print("Test2: {}\n", num_of_combinations);
   assert(num_of_combinations == 3);
 }
 
-int main() {
-  std::vector<int> jugs = LoadData();
+void Examples() {
   TestPart1();
-  int combinations = 0;
-  int min_used_jugs = jugs.size();
-  constexpr int used_jugs = 0;
-  FindJugCombinations(jugs, 150, used_jugs, min_used_jugs, combinations);
+  TestPart2();
+}
 
-  std::print("There are {} valid combinations.\n", combinations);
+constexpr int kEggnogLiters = 150;
 
-  TestPart2();
-  combinations = 0;
-  min_used_jugs = jugs.size();
-  FindJugCombinations(jugs, 150, used_jugs, min_used_jugs, combinations, true);
-
-  std::print(
-      "There are {} different ways to send {} jugs to shipping and "
-      "recieving.\n",
-      combinations, min_used_jugs);
-  return 0;
+int64_t Part1(const std::vector<int>& jugs) {
+  return CountAllCombinations(jugs, kEggnogLiters);
 }
+
+// The number of ways to fill the fewest jugs that hold all the eggnog.
+int64_t Part2(const std::vector<int>& jugs) {
+  return CountFewestJugCombinations(jugs, kEggnogLiters);
+}
+
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2015,
+                  .day = 17,
+                  .input_file = "./2015/day17.txt",
+                  .examples = Examples},
+                 Parse, Part1, Part2);
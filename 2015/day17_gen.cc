@@ -0,0 +1,21 @@
+// Generates 2015 day 17 inputs: --size containers of 5 to 50 liters. The
+// combination counts overflow past a few hundred containers.
+
+#include <cstdint>
+
+#include "utils/gen.h"
+
+namespace {
+
+void Generate(aoc::Generator& gen) {
+  for (int64_t i = 0; i < gen.size(); ++i) {
+    gen.Print("{}\n", gen.Uniform(5, 50));
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  return aoc::RunGenerator(
+      argc, argv, {.default_size = 20, .size_unit = "containers"}, Generate);
+}
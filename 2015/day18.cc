@@ -1,96 +1,109 @@
 #include <algorithm>
 #include <cassert>
 #include <print>
+#include <span>
+#include <string_view>
 
+#include "utils/day.h"
 #include "utils/utils.h"
 
+namespace {
+
+using ::aoc::Coordinate;
+
+// The lights are surrounded by a one cell border of kOutside, so neighbor
+// lookups never need a bounds check.
+using Lights = aoc::Grid<char>;
+
+constexpr char kOn = '#';
+constexpr char kOff = '.';
+constexpr char kOutside = ' ';
+
 struct Neighbors {
   int on = 0;
   int off = 0;
 };
 
-void PrettyPrint(const std::vector<std::string>& vec) {
+Lights MakeLights(const std::vector<std::string>& rows) {
+  return Lights::FromLines(rows, /*border=*/1, kOutside);
+}
+
+void PrettyPrint(const Lights& lights) {
   std::print("[");
-  for (size_t i = 0; i < vec.size(); ++i) {
-    std::print("\"{}\"", vec[i]);
-    if (i != vec.size() - 1) {
+  for (int row = 0; row < lights.NumRows(); ++row) {
+    std::span<const char> cells = lights.Row(row);
+    std::print("\"{}\"", std::string_view(cells.data(), cells.size()));
+    if (row != lights.NumRows() - 1) {
       std::print(", ");
     }
   }
   std::print("]\n");
 }
 
-bool IsInBounds(const std::vector<std::string>& lights, int row, int col) {
-  if (row < 0 || row >= lights.size() || col < 0 || col >= lights[0].size()) {
-    return false;
-  }
-  return true;
-}
-
-Neighbors GetNeighborStates(const std::vector<std::string>& lights, int row,
-                            int col) {
+Neighbors GetNeighborStates(const Lights& lights, int row, int col) {
   Neighbors neighbors;
   for (int i = row - 1; i <= row + 1; i++) {
     for (int j = col - 1; j <= col + 1; j++) {
       if (i == row && j == col) {
         continue;
-      } else {
-        if (IsInBounds(lights, i, j)) {
-          if (lights[i][j] == '#') {
-            neighbors.on++;
-          } else {
-            neighbors.off++;
-          }
-        }
+      }
+      char light = lights[Coordinate{i, j}];
+      if (light == kOn) {
+        neighbors.on++;
+      } else if (light == kOff) {
+        neighbors.off++;
       }
     }
   }
   return neighbors;
 }
 
-std::vector<std::string> GetNextState(const std::vector<std::string>& lights,
-                                      bool corners_stuck = false) {
-  std::vector<std::string> next_state(lights.size(),
-                                      std::string(lights.size(), '.'));
-  for (int i = 0; i < lights.size(); i++) {
-    for (int j = 0; j < lights.size(); j++) {
+// Writes the state after `lights` into `next_state`, which must have the same
+// dimensions. Reusing `next_state` across steps avoids allocating a new grid
+// every iteration.
+void GetNextState(const Lights& lights, Lights& next_state,
+                  bool corners_stuck = false) {
+  for (int i = 0; i < lights.NumRows(); i++) {
+    for (int j = 0; j < lights.NumCols(); j++) {
       Neighbors neighbors = GetNeighborStates(lights, i, j);
-      if (lights[i][j] == '#') {
+      char& next = next_state[Coordinate{i, j}];
+      next = kOff;
+      if (lights[Coordinate{i, j}] == kOn) {
         if (neighbors.on == 2 || neighbors.on == 3) {
-          next_state[i][j] = '#';
+          next = kOn;
         }
       } else {
         if (neighbors.on == 3) {
-          next_state[i][j] = '#';
+          next = kOn;
         }
       }
     }
   }
   if (corners_stuck) {
-    next_state[0][0] = '#';
-    next_state[0][next_state.size() - 1] = '#';
-    next_state[next_state.size() - 1][0] = '#';
-    next_state[next_state.size() - 1][next_state.size() - 1] = '#';
+    int last_row = next_state.NumRows() - 1;
+    int last_col = next_state.NumCols() - 1;
+    next_state[Coordinate{0, 0}] = kOn;
+    next_state[Coordinate{0, last_col}] = kOn;
+    next_state[Coordinate{last_row, 0}] = kOn;
+    next_state[Coordinate{last_row, last_col}] = kOn;
   }
-
-  return next_state;
 }
 
-int CountOnLights(std::vector<std::string> lights) {
-  int count = 0;
-  for (int i = 0; i < lights.size(); i++) {
-    for (int j = 0; j < lights.size(); j++) {
-      if (lights[i][j] == '#') {
-        count++;
-      }
-    }
+// Runs `steps` iterations, ping-ponging between two buffers.
+Lights Animate(Lights lights, int steps, bool corners_stuck = false) {
+  Lights next_state = lights;
+  for (int i = 0; i < steps; i++) {
+    GetNextState(lights, next_state, corners_stuck);
+    lights.swap(next_state);
   }
-  return count;
+  return lights;
 }
 
+int CountOnLights(const Lights& lights) { return lights.Count(kOn); }
+
 void TestGetNeighborStates() {
-  std::vector<std::string> lights = {
-      {"#...#"}, {"##..."}, {"###.#"}, {"..#.."}, {".#..#"}};
+  Lights lights = MakeLights(
+      {{"#...#"}, {"##..."}, {"###.#"}, {"..#.."}, {".#..#"}});
 
   Neighbors neighbors = GetNeighborStates(lights, 0, 0);
   assert(neighbors.on == 2 && neighbors.off == 1);
@@ -101,41 +114,48 @@ void TestGetNeighborStates() {
 }
 
 void TestGetNextState() {
-  std::vector<std::string> state1 = {{".#.#.#"}, {"...##."}, {"#....#"},
-                                     {"..#..."}, {"#.#..#"}, {"####.."}};
-  state1 = GetNextState(state1);
-  std::vector<std::string> state2 = {
-      {"..##.."}, {"..##.#"}, {"...##."}, {"......"}, {"#....."}, {"#.##.."},
-  };
+  Lights state1 = MakeLights({{".#.#.#"},
+                              {"...##."},
+                              {"#....#"},
+                              {"..#..."},
+                              {"#.#..#"},
+                              {"####.."}});
+  state1 = Animate(state1, 1);
+  Lights state2 = MakeLights({
+      {"..##.."},
+      {"..##.#"},
+      {"...##."},
+      {"......"},
+      {"#....."},
+      {"#.##.."},
+  });
   // PrettyPrint(state1);
   // PrettyPrint(state2);
   assert(state1 == state2);
 };
 
-int main() {
-  std::vector<std::string> initial_lights =
-      aoc::LoadStringsFromFileByLine("./2015/day18.txt");
-
+void Examples() {
   TestGetNeighborStates();
   TestGetNextState();
+}
 
-  std::vector<std::string> new_lights = initial_lights;
-  for (int i = 0; i < 100; i++) {
-    new_lights = GetNextState(new_lights);
-  }
+Lights Parse(std::string_view input) {
+  return MakeLights(aoc::SplitLines(input));
+}
 
-  int lights_on = CountOnLights(new_lights);
-  std::print("After 100 iterations, {} lights are on.\n", lights_on);
+int Part1(const Lights& initial_lights) {
+  return CountOnLights(Animate(initial_lights, 100));
+}
 
-  new_lights = initial_lights;
-  for (int i = 0; i < 100; i++) {
-    new_lights = GetNextState(new_lights, true);
-  }
+int Part2(const Lights& initial_lights) {
+  return CountOnLights(
+      Animate(initial_lights, 100, /*corners_stuck=*/true));
+}
 
-  lights_on = CountOnLights(new_lights);
-  std::print(
-      "After 100 iterations with the corner lights stuck, {} lights are on.\n",
-      lights_on);
+}  // namespace
 
-  return 0;
-}
+AOC_REGISTER_DAY({.year = 2015,
+                  .day = 18,
+                  .input_file = "./2015/day18.txt",
+                  .examples = Examples},
+                 Parse, Part1, Part2);
@@ -0,0 +1,25 @@
+// Generates 2015 day 18 inputs: a --size by --size grid of lights, each on
+// with probability one half.
+
+#include <cstdint>
+
+#include "utils/gen.h"
+
+namespace {
+
+void Generate(aoc::Generator& gen) {
+  for (int64_t r = 0; r < gen.size(); ++r) {
+    for (int64_t c = 0; c < gen.size(); ++c) {
+      gen.Write(gen.Chance(0.5) ? '#' : '.');
+    }
+    gen.Write('\n');
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  return aoc::RunGenerator(
+      argc, argv, {.default_size = 100, .size_unit = "rows and columns"},
+      Generate);
+}
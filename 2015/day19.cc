@@ -1,13 +1,17 @@
-#include <print>
-
 #include <cassert>
-#include <regex>
+#include <optional>
+#include <print>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 
+#include "utils/day.h"
+#include "utils/scan.h"
 #include "utils/utils.h"
 
+namespace {
+
 void PrettyPrintMap(
     const std::unordered_map<std::string, std::vector<std::string>>& map) {
   std::print("Map contents:\n");
@@ -25,18 +29,17 @@ void PrettyPrintMap(
 }
 
 std::unordered_map<std::string, std::vector<std::string>> ParseData(
-    std::vector<std::string> lines, std::string& molecule_input) {
+    const std::vector<std::string>& lines, std::string& molecule_input) {
   std::unordered_map<std::string, std::vector<std::string>>
       molecule_modifications;
 
-  std::regex pattern(R"((\w+) => (\w+))");
-  std::regex pattern2(R"(([A-Za-z]+))");
-  for (std::string& line : lines) {
-    std::smatch match;
-    if (std::regex_search(line, match, pattern)) {  // Check if match was found
-      molecule_modifications[match[1]].push_back(match[2]);
-    } else if (std::regex_search(line, match, pattern2)) {
-      molecule_input = match[0];
+  for (std::string_view line : lines) {
+    if (auto match = aoc::Scan<"{} => {}">(line)) {
+      auto [from, to] = *match;
+      molecule_modifications[std::string(from)].push_back(std::string(to));
+    } else if (!line.empty()) {
+      // The only other non-empty line is the medicine molecule.
+      molecule_input = line;
     }
   }
   return molecule_modifications;
@@ -126,17 +129,33 @@ void TestPart1() {
              .size() == 4);
 }
 
-int main() {
-  std::vector<std::string> lines =
-      aoc::LoadStringsFromFileByLine("./2015/day19.txt");
-  std::string medicine_molecule = "";
+struct Input {
   std::unordered_map<std::string, std::vector<std::string>>
-      molecule_modifications = ParseData(lines, medicine_molecule);
+      molecule_modifications;
+  std::string medicine_molecule;
+};
+
+Input Parse(std::string_view input) {
+  Input parsed;
+  parsed.molecule_modifications =
+      ParseData(aoc::SplitLines(input), parsed.medicine_molecule);
+  return parsed;
+}
+
+size_t Part1(const Input& input) {
+  return GetNextDistinctMolecules(input.molecule_modifications,
+                                  input.medicine_molecule)
+      .size();
+}
+
+// GenerateMedicineMolecule() searches forward from "e" and never finishes on
+// the real input.
+std::optional<int> Part2(const Input&) { return std::nullopt; }
 
-  std::unordered_set<std::string> distinct_molecules =
-      GetNextDistinctMolecules(molecule_modifications, medicine_molecule);
-  std::print("There are {} distinct molecule variations.\n",
-             distinct_molecules.size());
+}  // namespace
 
-  return 0;
-}
\ No newline at end of file
+AOC_REGISTER_DAY({.year = 2015,
+                  .day = 19,
+                  .input_file = "./2015/day19.txt",
+                  .examples = TestPart1},
+                 Parse, Part1, Part2);
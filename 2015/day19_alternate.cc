@@ -69,18 +69,20 @@ How long will it take to make the medicine? Given the available replacements and
 the medicine molecule in your puzzle input, what is the fewest number of steps
 to go from e to the medicine molecule?
 */
-#include <print>
-
 #include <map>
 #include <regex>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "absl/strings/cord.h"
+#include "utils/day.h"
 #include "utils/utils.h"
 
+namespace {
+
 std::multimap<std::string, std::string> GetSubstitutions(
     std::vector<std::string> lines) {
   constexpr int kKey = 1;
@@ -154,21 +156,26 @@ bool ReplaceFirstOccurrenceInPlace(absl::Cord& cord,
   return false;
 }
 
-int main() {
-  std::vector<std::string> lines =
-      aoc::LoadStringsFromFileByLine("./2015/day19_alternate.txt");
+struct Input {
+  std::string molecule;
+  std::multimap<std::string, std::string> substitutions;
+};
 
-  std::string molecule = lines.back();
-  std::multimap<std::string, std::string> substitutions =
-      GetSubstitutions(lines);
-  std::print("Unique Molecules: {}",
-             CountUniqueMolecules(molecule, substitutions));
+Input Parse(std::string_view input) {
+  std::vector<std::string> lines = aoc::SplitLines(input);
+  return {.molecule = lines.back(), .substitutions = GetSubstitutions(lines)};
+}
 
+int Part1(const Input& input) {
+  return CountUniqueMolecules(input.molecule, input.substitutions);
+}
+
+int Part2(const Input& input) {
   // Make a reverse substitution map.
   std::unordered_map<std::string, std::string> reverse_map =
-      ReverseMap(substitutions);
+      ReverseMap(input.substitutions);
 
-  absl::Cord molecule_cord(molecule);
+  absl::Cord molecule_cord(input.molecule);
 
   int steps = 0;
   while (molecule_cord != "e") {
@@ -178,10 +185,16 @@ int main() {
     for (const auto& [key, value] : reverse_map) {
       if (ReplaceFirstOccurrenceInPlace(molecule_cord, key, value)) {
         steps++;
-        std::print("{}: {}\n", steps, molecule_cord.Flatten());
       }
     }
   }
-
-  return 0;
+  return steps;
 }
+
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2015,
+                  .day = 19,
+                  .input_file = "./2015/day19_alternate.txt",
+                  .variant = "alternate"},
+                 Parse, Part1, Part2);
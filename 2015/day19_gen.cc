@@ -0,0 +1,41 @@
+// Generates 2015 day 19 inputs: 43 random replacements between a dozen
+// elements, then a medicine molecule of --size elements.
+
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+
+#include "utils/gen.h"
+
+namespace {
+
+constexpr std::string_view kElements[] = {"Al", "B", "Ca", "F",  "H",  "Mg",
+                                          "N",  "O", "P",  "Si", "Th", "Ti"};
+constexpr int kReplacements = 43;
+
+std::string_view RandomElement(aoc::Generator& gen) {
+  return kElements[gen.Uniform(0, std::size(kElements) - 1)];
+}
+
+void Generate(aoc::Generator& gen) {
+  for (int i = 0; i < kReplacements; ++i) {
+    gen.Print("{} => ", RandomElement(gen));
+    const int64_t length = gen.Uniform(2, 4);
+    for (int64_t j = 0; j < length; ++j) {
+      gen.Write(RandomElement(gen));
+    }
+    gen.Write('\n');
+  }
+  gen.Write('\n');
+  for (int64_t i = 0; i < gen.size(); ++i) {
+    gen.Write(RandomElement(gen));
+  }
+  gen.Write('\n');
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  return aoc::RunGenerator(
+      argc, argv, {.default_size = 300, .size_unit = "elements"}, Generate);
+}
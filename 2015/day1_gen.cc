@@ -0,0 +1,22 @@
+// Generates 2015 day 1 inputs: --size parentheses, each '(' or ')' with equal
+// odds.
+
+#include <cstdint>
+
+#include "utils/gen.h"
+
+namespace {
+
+void Generate(aoc::Generator& gen) {
+  for (int64_t i = 0; i < gen.size(); ++i) {
+    gen.Write(gen.Chance(0.5) ? '(' : ')');
+  }
+  gen.Write('\n');
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  return aoc::RunGenerator(
+      argc, argv, {.default_size = 7000, .size_unit = "characters"}, Generate);
+}
@@ -41,12 +41,14 @@ How many total feet of ribbon should they order?
 #include <algorithm>
 #include <array>
 #include <cassert>
-#include <iostream>
-#include <numeric>
-#include <sstream>
+#include <cstdint>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include "utils/day.h"
+#include "utils/line_stream.h"
 #include "utils/utils.h"
 
 namespace {
@@ -75,22 +77,6 @@ Present ParsePresent(const std::string& str, char delimiter) {
 
   return {.length = result[0], .width = result[1], .height = result[2]};
 }
-}  // namespace
-
-std::vector<Present> ParseInputFile() {
-  // Create an input string stream from the string
-  std::istringstream stream{aoc::ReadFileToString("./2015/day2.txt")};
-
-  std::vector<Present> presents;
-
-  std::string line;
-  // Use std::getline to read each line delimited by '\n'
-  while (std::getline(stream, line)) {
-    // std::cout << line << std::endl;
-    presents.push_back(ParsePresent(line, 'x'));
-  }
-  return presents;
-}
 
 int CalculateWrappingPaperRequirement(const Present& present) {
   // Compute the side areas a, b and c.
@@ -118,26 +104,39 @@ int CalculateRibbonRequirement(const Present& present) {
   return perimiter + Volume(present);
 }
 
-int main() {
-  std::vector<Present> presents = ParseInputFile();
-
-  // Tests.
+void Examples() {
   assert(CalculateWrappingPaperRequirement({2, 3, 4}) == 58);
   assert(CalculateWrappingPaperRequirement({1, 1, 10}) == 43);
   assert(CalculateRibbonRequirement({2, 3, 4}) == 34);
   assert(CalculateRibbonRequirement({1, 1, 10}) == 14);
+}
 
-  int paper_total = std::accumulate(
-      presents.cbegin(), presents.cend(), 0, [](int sum, const Present& p) {
-        return sum + CalculateWrappingPaperRequirement(p);
-      });
-
-  int ribbon_total = std::accumulate(
-      presents.cbegin(), presents.cend(), 0, [](int sum, const Present& p) {
-        return sum + CalculateRibbonRequirement(p);
-      });
-  std::cout << "Paper total: " << paper_total
-            << "\nRibbon total: " << ribbon_total << std::endl;
+// Both parts only need one present at a time, so Parse totals them as it
+// reads rather than keeping every present.
+struct Totals {
+  int64_t wrapping_paper = 0;
+  int64_t ribbon = 0;
+};
 
-  return 0;
+Totals Parse(aoc::LineStream& lines) {
+  Totals totals;
+  while (std::optional<std::string_view> line = lines.Next()) {
+    if (aoc::TrimWhitespace(*line).empty()) continue;
+    Present present = ParsePresent(std::string(*line), 'x');
+    totals.wrapping_paper += CalculateWrappingPaperRequirement(present);
+    totals.ribbon += CalculateRibbonRequirement(present);
+  }
+  return totals;
 }
+
+int64_t Part1(const Totals& totals) { return totals.wrapping_paper; }
+
+int64_t Part2(const Totals& totals) { return totals.ribbon; }
+
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2015,
+                  .day = 2,
+                  .input_file = "./2015/day2.txt",
+                  .examples = Examples},
+                 Parse, Part1, Part2);
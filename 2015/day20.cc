@@ -43,13 +43,14 @@ house.
 With these changes, what is the new lowest house number of the house to get at
 least as many presents as the number in your puzzle input?
 */
-#include <print>
-
 #include <cmath>
 #include <limits>
-// #include <vector>
+#include <string_view>
+
+#include "utils/day.h"
+#include "utils/extract_ints.h"
 
-constexpr int kInput = 34000000;
+namespace {
 
 int ComputeNumberOfPresents(int house, int multiplier,
                             int limit = std::numeric_limits<int>::max()) {
@@ -79,26 +80,32 @@ int ComputeNumberOfPresents(int house, int multiplier,
   return presents;
 }
 
-int main() {
-  constexpr int kElfMultiplier = 10;
-  constexpr int kElfMultiplierPartTwo = 11;
-  constexpr int kElfLimit = 50;
-
+// Returns the first house that gets more than `target` presents.
+int FirstHouseWithPresents(int target, int multiplier,
+                           int limit = std::numeric_limits<int>::max()) {
   for (int i = 1;; ++i) {
-    int presents = ComputeNumberOfPresents(i, kElfMultiplier);
-    if (presents > kInput) {
-      std::print("House {} gets {} presents.\n", i, presents);
-      break;
+    if (ComputeNumberOfPresents(i, multiplier, limit) > target) {
+      return i;
     }
   }
+}
 
-  // Part 2
-  for (int i = 1;; ++i) {
-    int presents = ComputeNumberOfPresents(i, kElfMultiplierPartTwo, kElfLimit);
-    if (presents > kInput) {
-      std::print("Part 2: House {} gets {} presents.\n", i, presents);
-      break;
-    }
-  }
-  return 0;
+int Parse(std::string_view input) {
+  return aoc::ExtractInts<1, int>(input)[0];
 }
+
+int Part1(int target) {
+  constexpr int kElfMultiplier = 10;
+  return FirstHouseWithPresents(target, kElfMultiplier);
+}
+
+int Part2(int target) {
+  constexpr int kElfMultiplierPartTwo = 11;
+  constexpr int kElfLimit = 50;
+  return FirstHouseWithPresents(target, kElfMultiplierPartTwo, kElfLimit);
+}
+
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2015, .day = 20, .input_literal = "34000000"},
+                 Parse, Part1, Part2);
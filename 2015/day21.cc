@@ -69,12 +69,19 @@ of each item.
 
 What is the most amount of gold you can spend and still lose the fight?
 */
-#include <print>
-
 #include <algorithm>
+#include <limits>
 #include <optional>
+#include <string>
+#include <string_view>
 #include <vector>
 
+#include "utils/day.h"
+#include "utils/extract_ints.h"
+#include "utils/utils.h"
+
+namespace {
+
 struct Character {
   int health = 0;
   int damage = 0;
@@ -110,13 +117,13 @@ struct Player : public Character {
   std::optional<Item> right_ring = std::nullopt;
   std::optional<Item> left_ring = std::nullopt;
 
-  void Print() {
-    std::print("Equipment:[{}, {}, {}, {}] Cost: {} Win: {}\n",
-               weapon ? weapon->name : "None",
-               armor_set ? armor_set->name : "None",
-               right_ring ? right_ring->name : "None",
-               left_ring ? left_ring->name : "None", Cost(),
-               WouldWin() ? "Yes" : "No");
+  void Print(const Character& boss) {
+    AOC_LOG(DEBUG, "Equipment:[{}, {}, {}, {}] Cost: {} Win: {}",
+            weapon ? weapon->name : "None",
+            armor_set ? armor_set->name : "None",
+            right_ring ? right_ring->name : "None",
+            left_ring ? left_ring->name : "None", Cost(),
+            WouldWin(boss) ? "Yes" : "No");
   }
 
   bool CanTake(const Item& item) {
@@ -163,21 +170,19 @@ struct Player : public Character {
     cost += right_ring ? right_ring->cost : 0;
     cost += left_ring ? left_ring->cost : 0;
     if (cost < 0) {
-      std::print("Cost < 0. Weapon: {}: {}, {}: {}, {}: {}, {}: {}\n",
-                 weapon ? weapon->name : "None", weapon ? weapon->cost : -1,
-                 armor_set ? armor_set->name : "None",
-                 armor_set ? armor_set->cost : -1,
-                 right_ring ? right_ring->name : "None",
-                 right_ring ? right_ring->cost : -1,
-                 left_ring ? left_ring->name : "None",
-                 left_ring ? left_ring->cost : -1);
+      AOC_LOG(ERROR, "Cost < 0. Weapon: {}: {}, {}: {}, {}: {}, {}: {}",
+              weapon ? weapon->name : "None", weapon ? weapon->cost : -1,
+              armor_set ? armor_set->name : "None",
+              armor_set ? armor_set->cost : -1,
+              right_ring ? right_ring->name : "None",
+              right_ring ? right_ring->cost : -1,
+              left_ring ? left_ring->name : "None",
+              left_ring ? left_ring->cost : -1);
     }
     return cost;
   }
 
-  bool WouldWin() {
-    Character boss{.health = 100, .damage = 8, .armor = 2};
-
+  bool WouldWin(Character boss) {
     // Reset player health before attempting any battle.
     health = 100;
     while (true) {
@@ -191,7 +196,8 @@ struct Player : public Character {
   bool IsFull() { return weapon && armor && right_ring && left_ring; }
 };
 
-void FindCheapestWinningPlayer(const std::vector<Item>& shop, Player player,
+void FindCheapestWinningPlayer(const std::vector<Item>& shop,
+                               const Character& boss, Player player,
                                int shop_idx, int& cheapest_win) {
   if (player.IsFull() || shop.size() <= shop_idx) {
     // We've exhausted the shop, or the player can't take any more items.
@@ -203,22 +209,28 @@ void FindCheapestWinningPlayer(const std::vector<Item>& shop, Player player,
     // Recurse in two directions - with and without this item.
     Player new_player = player;
     new_player.Take(next_item);
-    new_player.Print();
-    if (new_player.IsValid() && new_player.WouldWin()) {
+    if (new_player.IsValid() && new_player.WouldWin(boss)) {
       // This is the cheapest winning player!
 
       cheapest_win = std::min(new_player.Cost(), cheapest_win);
       // std::print("Found a cheap win! Cost: {}, Cheapest: {}\n",
       //            player.Cost(), cheapest_win);
     }
-    FindCheapestWinningPlayer(shop, new_player, shop_idx + 1, cheapest_win);
+    FindCheapestWinningPlayer(shop, boss, new_player, shop_idx + 1,
+                              cheapest_win);
   }
   // Recurse with the next shop_idx.
-  FindCheapestWinningPlayer(shop, player, shop_idx + 1, cheapest_win);
+  FindCheapestWinningPlayer(shop, boss, player, shop_idx + 1, cheapest_win);
   return;
 }
 
-int main() {
+// "Hit Points: 100\nDamage: 8\nArmor: 2"
+Character Parse(std::string_view input) {
+  auto [health, damage, armor] = aoc::ExtractInts<3, int>(input);
+  return {.health = health, .damage = damage, .armor = armor};
+}
+
+int Part1(const Character& boss) {
   /*
 
 Weapons:    Cost  Damage  Armor
@@ -267,12 +279,13 @@ Defense +3   80     0       3
             [](const Item& a, const Item& b) { return a.cost < b.cost; });
 
   int cheapest_win = std::numeric_limits<int>::max();
-  FindCheapestWinningPlayer(shop, Player{}, /*shop_idx=*/0, cheapest_win);
-
-  std::print("Cheapest_win: {}\n", cheapest_win);
-
-  // Below is a more direct iterative solution.
+  FindCheapestWinningPlayer(shop, boss, Player{}, /*shop_idx=*/0,
+                            cheapest_win);
+  return cheapest_win;
+}
 
+// Tries every loadout directly rather than searching the shop.
+int Part2(const Character& boss) {
   std::vector<Item> weapons = {{"Dagger", 8, 4, 0, Type::kWeapon},
                                {"Shortsword", 10, 5, 0, Type::kWeapon},
                                {"Warhammer", 25, 6, 0, Type::kWeapon},
@@ -292,7 +305,6 @@ Defense +3   80     0       3
       {"Armor2", 40, 0, 2, Type::kRing},   {"Armor3", 80, 0, 3, Type::kRing},
       {"Empty1", 0, 0, 0, Type::kRing},    {"Empty2", 0, 0, 0, Type::kRing}};
 
-  cheapest_win = std::numeric_limits<int>::max();
   int most_expensive_loss = 0;
   for (const auto& weapon : weapons) {
     for (const auto& armor : armors) {
@@ -307,17 +319,19 @@ Defense +3   80     0       3
           player.Take(armor);
           player.Take(rings[i]);
           player.Take(rings[j]);
-          if (player.WouldWin()) {
-            cheapest_win = std::min(cheapest_win, player.Cost());
-          } else {
+          if (!player.WouldWin(boss)) {
             most_expensive_loss = std::max(most_expensive_loss, player.Cost());
           }
         }
       }
     }
   }
-  std::print("Cheapest win: {}\nMost Expensive loss: {}\n", cheapest_win,
-             most_expensive_loss);
-
-  return 0;
+  return most_expensive_loss;
 }
+
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2015,
+                  .day = 21,
+                  .input_literal = "Hit Points: 100\nDamage: 8\nArmor: 2"},
+                 Parse, Part1, Part2);
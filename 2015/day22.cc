@@ -130,15 +130,21 @@ You start with 50 hit points and 500 mana points. The boss's actual stats are in
 your puzzle input. What is the least amount of mana you can spend and still win
 the fight? (Do not include mana recharge effects as "spending" negative mana.)
 */
-#include <print>
-
 #include <algorithm>
-#include <cstdlib>
 #include <limits>
 #include <memory>
 #include <optional>
+#include <string>
+#include <string_view>
 #include <vector>
 
+#include "absl/log/check.h"
+#include "utils/day.h"
+#include "utils/extract_ints.h"
+#include "utils/utils.h"
+
+namespace {
+
 struct Character {
   int health = 0;
   int damage = 0;
@@ -180,17 +186,16 @@ std::string ToString(SpellType spell_type) {
       return "Unknown";
   }
 }
-// Function to pretty-print a list of SpellType values
-void PrettyPrintSpellList(const std::vector<SpellType>& spells) {
-  bool first = true;
+// Formats a list of SpellType values as "Poison, Drain, ...".
+std::string SpellListToString(const std::vector<SpellType>& spells) {
+  std::string out;
   for (const auto& spell : spells) {
-    if (!first) {
-      std::print(", ");
+    if (!out.empty()) {
+      out += ", ";
     }
-    std::print("{}", ToString(spell));
-    first = false;
+    out += ToString(spell);
   }
-  std::print("\n");
+  return out;
 }
 struct Spell {
   int turns_remaining = 0;
@@ -274,10 +279,8 @@ struct GameState {
   void CastSpell(Spell spell) {
     mana_spent += spell.mana_cost;
     wizard.mana -= spell.mana_cost;
-    if (wizard.mana < 0) {
-      std::print("Error!! Spell: {}\n", ToString(spell.type));
-      std::exit(0);
-    }
+    CHECK_GE(wizard.mana, 0)
+        << "Cast " << ToString(spell.type) << " without the mana for it.";
     // std::print("Cast spell {}. Remaining mana: {}\n", ToString(spell.type),
     //            wizard.mana);
     spells_cast.push_back(spell.type);
@@ -300,9 +303,9 @@ struct GameState {
       int old_mana_spent = min_mana_spent;
       min_mana_spent = std::min(min_mana_spent, mana_spent);
       if (min_mana_spent != old_mana_spent) {
-        std::print("Found a new best strategy! Mana spent: {}\n",
-                   min_mana_spent);
-        PrettyPrintSpellList(spells_cast);
+        AOC_LOG(DEBUG, "Found a new best strategy! Mana spent: {}",
+                min_mana_spent);
+        AOC_LOG(DEBUG, "{}", SpellListToString(spells_cast));
       }
       return true;
     }
@@ -348,11 +351,28 @@ void TakeGameTurn(GameState state, int& min_mana_spent,
   return;
 }
 
-int main() {
+// "Hit Points: 55\nDamage: 8"
+Character Parse(std::string_view input) {
+  auto [health, damage] = aoc::ExtractInts<2, int>(input);
+  return {.health = health, .damage = damage};
+}
+
+int Part1(const Character& boss) {
   int min_mana_spent = std::numeric_limits<int>::max();
-  TakeGameTurn(GameState{}, min_mana_spent);
+  TakeGameTurn(GameState{.boss = boss}, min_mana_spent);
+  return min_mana_spent;
+}
+
+int Part2(const Character& boss) {
   int hard_mode_min_mana_spent = std::numeric_limits<int>::max();
-  TakeGameTurn(GameState{}, hard_mode_min_mana_spent, /*hard_mode=*/true);
-  std::print("Part 1: {} Part 2: {}\n", min_mana_spent,
-             hard_mode_min_mana_spent);
+  TakeGameTurn(GameState{.boss = boss}, hard_mode_min_mana_spent,
+               /*hard_mode=*/true);
+  return hard_mode_min_mana_spent;
 }
+
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2015,
+                  .day = 22,
+                  .input_literal = "Hit Points: 55\nDamage: 8"},
+                 Parse, Part1, Part2);
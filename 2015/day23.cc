@@ -43,13 +43,18 @@ Marie with her computer. Definitely not to distract you, what is the value in
 register b after the program is finished executing if register a starts as 1
 instead?
 */
-#include <print>
-
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include "utils/day.h"
 #include "utils/utils.h"
 
+namespace {
+
 // Function to check if a string starts with a given prefix
 bool StartsWith(const std::string& str, const std::string& prefix) {
   if (prefix.size() > str.size()) {
@@ -105,12 +110,11 @@ void Jump(const std::string& instruction, int& i) {
   i += distance;
 }
 
-int main() {
-  std::vector<std::string> instructions =
-      aoc::LoadStringsFromFileByLine("./2015/day23.txt");
-
+// Runs the program with register a starting at `initial_a`. Returns the final
+// value of register b.
+int64_t Run(const std::vector<std::string>& instructions, int64_t initial_a) {
   // These have to be 64 bit (it overflowed with 32).
-  int64_t a = 0;
+  int64_t a = initial_a;
   int64_t b = 0;
 
   // Given the instruction, returns the register (by reference) that this
@@ -123,9 +127,9 @@ int main() {
   };
 
   for (int i = 0; i < instructions.size(); ++i) {
-    std::string& instruction = instructions[i];
-    std::print("Executing instruction {}. a[{}] b[{}] instruction: {}\n", i, a,
-               b, instruction);
+    const std::string& instruction = instructions[i];
+    AOC_LOG(TRACE, "Executing instruction {}. a[{}] b[{}] instruction: {}", i,
+            a, b, instruction);
     // If this instruction requires a register, store a ref to it here.
     int64_t& reg = GetRegister(instruction);
     if (StartsWith(instruction, "hlf")) {
@@ -146,6 +150,23 @@ int main() {
       }
     }
   }
-  std::print("The final value of the registers are a: {} b: {}\n", a, b);
-  return 0;
+  AOC_LOG(DEBUG, "The final value of the registers are a: {} b: {}", a, b);
+  return b;
 }
+
+std::vector<std::string> Parse(std::string_view input) {
+  return aoc::SplitLines(input);
+}
+
+int64_t Part1(const std::vector<std::string>& instructions) {
+  return Run(instructions, /*initial_a=*/0);
+}
+
+int64_t Part2(const std::vector<std::string>& instructions) {
+  return Run(instructions, /*initial_a=*/1);
+}
+
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2015, .day = 23, .input_file = "./2015/day23.txt"},
+                 Parse, Part1, Part2);
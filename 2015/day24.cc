@@ -62,10 +62,21 @@ configuration?
 #include <format>
 #include <functional>
 #include <numeric>
-#include <print>
+#include <string_view>
 #include <unordered_set>
 #include <vector>
 
+#include "utils/day.h"
+#include "utils/extract_ints.h"
+#include "utils/utils.h"
+
+namespace {
+
+// Just copy input data here.
+constexpr std::string_view kInput =
+    "1 2 3 5 7 13 17 19 23 29 31 37 41 43 53 59 61 67 71 73 79 83 89 97 101 "
+    "103 107 109 113";
+
 constexpr int kSizeOfInput = 29;
 
 using Bitset = std::bitset<kSizeOfInput>;
@@ -84,8 +95,7 @@ void PrettyPrintSet(const std::unordered_set<int>& set) {
 
   result += "}";
 
-  // Use std::print to print the formatted output
-  std::print("{}\n", result);
+  AOC_LOG(DEBUG, "{}", result);
 }
 
 int Sum(const std::vector<int>& packages, const Bitset& selected) {
@@ -128,9 +138,11 @@ void FindSolution(const std::vector<int>& packages, int target,
   if (weight == target) {
     if (best.empty() || num_selected < best.size()) {
       // we found a new best!
-      std::print("New best found, with only {} packages.\n", num_selected);
+      AOC_LOG(DEBUG, "New best found, with only {} packages.", num_selected);
       best = GetSet(packages, selected);
-      PrettyPrintSet(best);
+      if constexpr (AOC_LOG_ENABLED(DEBUG)) {
+        PrettyPrintSet(best);
+      }
     }
     std::unordered_set<int> candidate_set = GetSet(packages, selected);
     // If we get here, we have a candidate of equal size. Evaluate quantum
@@ -142,12 +154,14 @@ void FindSolution(const std::vector<int>& packages, int target,
                         std::multiplies<int64_t>());
     if (candidate_qe < best_qe) {
       // overwrite the best.
-      std::print(
-          "New best found, still with {} packages, but a lower qe: {} vs. "
-          "{}.\n",
-          num_selected, candidate_qe, best_qe);
+      AOC_LOG(DEBUG,
+              "New best found, still with {} packages, but a lower qe: {} vs. "
+              "{}.",
+              num_selected, candidate_qe, best_qe);
       best = candidate_set;
-      PrettyPrintSet(best);
+      if constexpr (AOC_LOG_ENABLED(DEBUG)) {
+        PrettyPrintSet(best);
+      }
     } else {
       //      std::print(
       //          "New tie found, still with {} packages, but a higher qe: {}
@@ -174,19 +188,25 @@ void FindSolution(const std::vector<int>& packages, int target,
   selected.reset(candidate_idx);
   FindSolution(packages, target, selected, candidate_idx + 1, best);
 }
-int main() {
-  // Just copy input data here.
-  std::vector<int> packages = {1,  2,  3,  5,  7,   13,  17,  19,  23, 29,
-                               31, 37, 41, 43, 53,  59,  61,  67,  71, 73,
-                               79, 83, 89, 97, 101, 103, 107, 109, 113};
 
-  // For all groups to be equal in weight, each group _must_ weigh exactly
-  // 1/3 of the total.
-  const int target_weight =
-      std::accumulate(packages.begin(), packages.end(), 0) / 3;
+std::vector<int> Parse(std::string_view input) {
+  std::vector<int64_t> values;
+  aoc::ExtractInts(input, values);
+  std::vector<int> packages(values.begin(), values.end());
 
   // Put the packages in reverse order to find the smallest groups first.
   std::reverse(packages.begin(), packages.end());
+  return packages;
+}
+
+// The quantum entanglement of the smallest group that weighs 1/num_groups of
+// the total.
+int64_t BestQuantumEntanglement(const std::vector<int>& packages,
+                                int num_groups) {
+  // For all groups to be equal in weight, each group _must_ weigh exactly
+  // 1/num_groups of the total.
+  const int target_weight =
+      std::accumulate(packages.begin(), packages.end(), 0) / num_groups;
 
   std::unordered_set<int> best_solution;
   Bitset selected;
@@ -194,23 +214,19 @@ int main() {
   FindSolution(packages, target_weight, selected, /*candidate_idx=*/0,
                best_solution);
 
-  int64_t best_qe = std::accumulate(best_solution.begin(), best_solution.end(),
-                                    1l, std::multiplies<int64_t>());
-
-  std::print("Part 1 - Best QE: {}\n", best_qe);
-
-  const int new_target_weight =
-      std::accumulate(packages.begin(), packages.end(), 0) / 4;
-
-  best_solution.clear();
-  selected.reset();
+  return std::accumulate(best_solution.begin(), best_solution.end(), 1l,
+                         std::multiplies<int64_t>());
+}
 
-  FindSolution(packages, new_target_weight, selected, 0, best_solution);
+int64_t Part1(const std::vector<int>& packages) {
+  return BestQuantumEntanglement(packages, 3);
+}
 
-  best_qe = std::accumulate(best_solution.begin(), best_solution.end(), 1l,
-                            std::multiplies<int64_t>());
+int64_t Part2(const std::vector<int>& packages) {
+  return BestQuantumEntanglement(packages, 4);
+}
 
-  std::print("Part 2 - Best QE: {}\n", best_qe);
+}  // namespace
 
-  return 0;
-}
+AOC_REGISTER_DAY({.year = 2015, .day = 24, .input_literal = kInput},
+                 Parse, Part1, Part2);
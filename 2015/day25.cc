@@ -79,38 +79,35 @@ sits at the bottom, awaiting its friends. Looks like you need to provide 49
 yourself.
 */
 
-#include <print>
-
 #include <cassert>
+#include <cstdint>
 #include <cstdlib>
+#include <optional>
+#include <string_view>
 
-#include "absl/container/flat_hash_map.h"
+#include "utils/day.h"
+#include "utils/extract_ints.h"
+#include "utils/memo.h"
 #include "utils/utils.h"
 
-int64_t GetRowOffset(int64_t row) {
-  // Memo of row to row offset.
-  static absl::flat_hash_map<int64_t, int64_t> row_offset_memo;
+namespace {
 
-  // Memo case.
-  if (row_offset_memo.contains(row)) {
-    return row_offset_memo[row];
-  }
+// Row to row offset. Each solve makes its own, so reruns start cold.
+using RowOffsetMemo = aoc::Memo<int64_t, int64_t>;
 
-  // We haven't memoized this value. Calulate it and store it.
-  if (row == 1) {
-    // Set the base case in the memo.
-    row_offset_memo[row] = 0;
-  } else {
+int64_t GetRowOffset(int64_t row, RowOffsetMemo& memo) {
+  return memo.GetOrCompute(row, [&memo](int64_t row) -> int64_t {
+    // The base case.
+    if (row == 1) {
+      return 0;
+    }
     int64_t prev_row = row - 1;
-    int64_t row_offset = prev_row + GetRowOffset(prev_row);
-    row_offset_memo[row] = row_offset;
-  }
-
-  return row_offset_memo[row];
+    return prev_row + GetRowOffset(prev_row, memo);
+  });
 }
 
 // convert a row and column to an index in the algorithm.
-int64_t GetIndex(int64_t row, int64_t col) {
+int64_t GetIndex(int64_t row, int64_t col, RowOffsetMemo& memo) {
   assert(row >= 1);
   assert(col >= 1);
 
@@ -124,15 +121,15 @@ int64_t GetIndex(int64_t row, int64_t col) {
   // - We just have to travel along the hypotenuse, adding 1 for every step
   // right (the col).
   // - Thus the full formula is:
-  return GetRowOffset(row + col - 1) + col;
+  return GetRowOffset(row + col - 1, memo) + col;
 }
 
-int64_t GetCode(int64_t row, int64_t col) {
+int64_t GetCode(int64_t row, int64_t col, RowOffsetMemo& memo) {
   // The initial value is loaded in here.
   int64_t value = 20151125;
 
   // Apply the algorithim idx times.
-  int64_t idx = GetIndex(row, col);
+  int64_t idx = GetIndex(row, col, memo);
   for (int64_t i = 2; i <= idx; ++i) {
     value = (value * 252533) % 33554393;
     // std::print("{} : {}\n", i, value);
@@ -140,28 +137,53 @@ int64_t GetCode(int64_t row, int64_t col) {
   return value;
 }
 
-int main() {
-  constexpr int kRow = 2981;
-  constexpr int kCol = 3075;
+void Examples() {
+  RowOffsetMemo memo;
+  assert(GetRowOffset(1, memo) == 0);
+  assert(GetRowOffset(2, memo) == 1);
+  assert(GetRowOffset(3, memo) == 3);
+  assert(GetRowOffset(4, memo) == 6);
+  assert(GetRowOffset(5, memo) == 10);
+  assert(GetRowOffset(6, memo) == 15);
+
+  assert(GetIndex(4, 3, memo) == 18);
+  assert(GetIndex(2, 4, memo) == 14);
+  assert(GetIndex(1, 6, memo) == 21);
+  assert(GetIndex(6, 1, memo) == 16);
+
+  assert(GetCode(1, 1, memo) == 20151125);
+  assert(GetCode(1, 2, memo) == 18749137);
+  assert(GetCode(2, 1, memo) == 31916031);
+  assert(GetCode(4, 3, memo) == 21345942);
+}
 
-  assert(GetRowOffset(1) == 0);
-  assert(GetRowOffset(2) == 1);
-  assert(GetRowOffset(3) == 3);
-  assert(GetRowOffset(4) == 6);
-  assert(GetRowOffset(5) == 10);
-  assert(GetRowOffset(6) == 15);
+struct Position {
+  int64_t row = 0;
+  int64_t col = 0;
+};
 
-  assert(GetIndex(4, 3) == 18);
-  assert(GetIndex(2, 4) == 14);
-  assert(GetIndex(1, 6) == 21);
-  assert(GetIndex(6, 1) == 16);
+// "row 2981, column 3075"
+Position Parse(std::string_view input) {
+  auto [row, col] = aoc::ExtractInts<2>(input);
+  return {.row = row, .col = col};
+}
+
+int64_t Part1(const Position& position) {
+  RowOffsetMemo memo;
+  int64_t code = GetCode(position.row, position.col, memo);
+  aoc::MemoStats stats = memo.Stats();
+  AOC_LOG(DEBUG, "Row offset memo: {} hits, {} misses, {} rows", stats.hits,
+          stats.misses, stats.size);
+  return code;
+}
 
-  assert(GetCode(1, 1) == 20151125);
-  assert(GetCode(1, 2) == 18749137);
-  assert(GetCode(2, 1) == 31916031);
-  assert(GetCode(4, 3) == 21345942);
+// Day 25 has no second puzzle.
+std::optional<int64_t> Part2(const Position&) { return std::nullopt; }
 
-  std::print("The answer is {}\n", GetCode(kRow, kCol));
+}  // namespace
 
-  return 0;
-}
+AOC_REGISTER_DAY({.year = 2015,
+                  .day = 25,
+                  .input_literal = "row 2981, column 3075",
+                  .examples = Examples},
+                 Parse, Part1, Part2);
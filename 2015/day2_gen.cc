@@ -0,0 +1,21 @@
+// Generates 2015 day 2 inputs: --size presents, "LxWxH" with sides 1 to 30.
+
+#include <cstdint>
+
+#include "utils/gen.h"
+
+namespace {
+
+void Generate(aoc::Generator& gen) {
+  for (int64_t i = 0; i < gen.size(); ++i) {
+    gen.Print("{}x{}x{}\n", gen.Uniform(1, 30), gen.Uniform(1, 30),
+              gen.Uniform(1, 30));
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  return aoc::RunGenerator(
+      argc, argv, {.default_size = 1000, .size_unit = "presents"}, Generate);
+}
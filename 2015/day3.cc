@@ -41,9 +41,16 @@ where they started.
 and Robo-Santa going the other.
 */
 
+#include <cassert>
+#include <string>
+#include <string_view>
+
 #include "absl/container/flat_hash_set.h"
+#include "utils/day.h"
 #include "utils/utils.h"
 
+namespace {
+
 // Define a struct to represent a coordinate
 struct Coordinate {
   int x = 0;
@@ -91,7 +98,7 @@ absl::flat_hash_set<Coordinate, CoordinateHash> ComputeVisitedHouseSet(
         break;
       }
       default: {
-        std::cout << "Unexpected character: " << c << "\n";
+        AOC_LOG(ERROR, "Unexpected character: {}", c);
       }
     }
     // Regardless of what happens, add the visited home to the set.
@@ -133,21 +140,32 @@ absl::flat_hash_set<Coordinate, CoordinateHash> ComputeVisitedHouseSetWithRobo(
   return visited_houses;
 }
 
-int main() {
-  std::string input = aoc::ReadFileToString("./2015/day3.txt");
-
+void Examples() {
   assert(ComputeVisitedHouseSet("^").size() == 2);
   assert(ComputeVisitedHouseSet("^>v<").size() == 4);
   assert(ComputeVisitedHouseSet("^v^v^v^v^v").size() == 2);
 
-  std::cout << "Number of visited homes: "
-            << ComputeVisitedHouseSet(input).size() << "\n";
-
   assert(ComputeVisitedHouseSetWithRobo("^v").size() == 3);
   assert(ComputeVisitedHouseSetWithRobo("^>v<").size() == 3);
   assert(ComputeVisitedHouseSetWithRobo("^v^v^v^v^v").size() == 11);
+}
 
-  std::cout << "Number of visited homes with robo: "
-            << ComputeVisitedHouseSetWithRobo(input).size() << "\n";
-  return 0;
+std::string_view Parse(std::string_view input) {
+  return aoc::TrimWhitespace(input);
 }
+
+size_t Part1(std::string_view input) {
+  return ComputeVisitedHouseSet(input).size();
+}
+
+size_t Part2(std::string_view input) {
+  return ComputeVisitedHouseSetWithRobo(input).size();
+}
+
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2015,
+                  .day = 3,
+                  .input_file = "./2015/day3.txt",
+                  .examples = Examples},
+                 Parse, Part1, Part2);
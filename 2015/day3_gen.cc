@@ -0,0 +1,21 @@
+// Generates 2015 day 3 inputs: --size moves, each one of ^ v < >.
+
+#include <cstdint>
+
+#include "utils/gen.h"
+
+namespace {
+
+void Generate(aoc::Generator& gen) {
+  for (int64_t i = 0; i < gen.size(); ++i) {
+    gen.Write(gen.Pick("^v<>"));
+  }
+  gen.Write('\n');
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  return aoc::RunGenerator(
+      argc, argv, {.default_size = 8192, .size_unit = "moves"}, Generate);
+}
@@ -24,14 +24,20 @@ Now find one that starts with six zeroes.
 
 #include <openssl/md5.h>  // This is provided by BoringSSL
 
+#include <algorithm>
 #include <cassert>
 #include <iomanip>
-#include <iostream>
+#include <limits>
 #include <sstream>
 #include <string>
+#include <string_view>
 
+#include "utils/day.h"
+#include "utils/thread_pool.h"
 #include "utils/utils.h"
 
+namespace {
+
 std::string ComputeMd5(const std::string& str) {
   // Create an MD5 digest context
   MD5_CTX ctx;
@@ -53,34 +59,54 @@ std::string ComputeMd5(const std::string& str) {
   return oss.str();
 }
 
-int FindAdventCoin(std::string secret_key, int num_of_zeroes) {
-  for (int i = 1;; ++i) {
-    bool valid_coin = true;
-    std::string hash = ComputeMd5(secret_key + std::to_string(i));
-    for (int j = 0; j < num_of_zeroes; j++) {
-      if (hash[j] != '0') {
-        valid_coin = false;
-      }
+bool IsAdventCoin(const std::string& secret_key, int num_of_zeroes, int i) {
+  std::string hash = ComputeMd5(secret_key + std::to_string(i));
+  for (int j = 0; j < num_of_zeroes; j++) {
+    if (hash[j] != '0') {
+      return false;
     }
-    if (valid_coin) {
-      return i;
+  }
+  return true;
+}
+
+int FindAdventCoin(std::string secret_key, int num_of_zeroes) {
+  // Search a window of nonces at a time in parallel and take the smallest
+  // coin found in it, so the answer is the same as a serial search.
+  constexpr int kWindow = 1 << 16;
+  constexpr int kNotFound = std::numeric_limits<int>::max();
+  for (int start = 1;; start += kWindow) {
+    int coin = aoc::ParallelReduce(
+        start, start + kWindow, kNotFound,
+        [&](int64_t i) {
+          return IsAdventCoin(secret_key, num_of_zeroes, i) ? i : kNotFound;
+        },
+        [](int a, int b) { return std::min(a, b); });
+    if (coin != kNotFound) {
+      return coin;
     }
   }
 }
 
-int main() {
-  std::string key = "yzbqklnj";
-  int num_starting_zeroes = 5;
+void Examples() {
+  assert(FindAdventCoin("abcdef", 5) == 609043);
+  assert(FindAdventCoin("pqrstuv", 5) == 1048970);
+}
 
+std::string Parse(std::string_view input) {
+  std::string key(aoc::TrimWhitespace(input));
   // Go ahead and reserve space for appending numeric values.
   key.reserve(20);
+  return key;
+}
 
-  assert(FindAdventCoin("abcdef", num_starting_zeroes) == 609043);
-  assert(FindAdventCoin("pqrstuv", num_starting_zeroes) == 1048970);
+int Part1(const std::string& key) { return FindAdventCoin(key, 5); }
 
-  std::cout << "5 zeroes: " << FindAdventCoin(key, num_starting_zeroes) << "\n";
-  num_starting_zeroes = 6;
-  std::cout << "6 zeroes: " << FindAdventCoin(key, num_starting_zeroes) << "\n";
+int Part2(const std::string& key) { return FindAdventCoin(key, 6); }
 
-  return 0;
-}
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2015,
+                  .day = 4,
+                  .input_literal = "yzbqklnj",
+                  .examples = Examples},
+                 Parse, Part1, Part2);
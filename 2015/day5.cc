@@ -48,102 +48,126 @@ How many strings are nice under these new rules?
 
 Your puzzle answer was 69.
 */
+#include <algorithm>
 #include <cassert>
-#include <iostream>
+#include <cstdint>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
-#include "utils/utils.h"
+#include "utils/day.h"
+#include "utils/line_stream.h"
 
-int NumOfNiceStrings(std::vector<std::string> inputs) {
-  int nice_count = 0;
-  for (const auto& input : inputs) {
-    if (input.find("ab") != std::string::npos ||
-        input.find("cd") != std::string::npos ||
-        input.find("pq") != std::string::npos ||
-        input.find("xy") != std::string::npos) {
-      continue;
-    }
+namespace {
 
-    int vowel_count = 0;
-    bool has_double = false;
+bool IsNice(std::string_view input) {
+  if (input.find("ab") != std::string_view::npos ||
+      input.find("cd") != std::string_view::npos ||
+      input.find("pq") != std::string_view::npos ||
+      input.find("xy") != std::string_view::npos) {
+    return false;
+  }
 
-    for (int i = 0; i < input.length(); i++) {
-      if (i + 1 < input.length()) {
-        if (input[i] == input[i + 1]) {
-          has_double = true;
-        }
-      }
-      if (input[i] == 'a' || input[i] == 'e' || input[i] == 'i' ||
-          input[i] == 'o' || input[i] == 'u') {
-        vowel_count++;
-      }
-      if (has_double && vowel_count >= 3) {
-        nice_count++;
-        break;
+  int vowel_count = 0;
+  bool has_double = false;
+
+  for (int i = 0; i < input.length(); i++) {
+    if (i + 1 < input.length()) {
+      if (input[i] == input[i + 1]) {
+        has_double = true;
       }
     }
+    if (input[i] == 'a' || input[i] == 'e' || input[i] == 'i' ||
+        input[i] == 'o' || input[i] == 'u') {
+      vowel_count++;
+    }
+    if (has_double && vowel_count >= 3) {
+      return true;
+    }
   }
-  return nice_count;
+  return false;
 }
 
-int NumOfBetterNiceStrings(std::vector<std::string> inputs) {
-  int nice_count = 0;
-  for (const auto& input : inputs) {
-    std::unordered_map<std::string, int> pair_starting_positions;
-    bool has_separate_doubles = false;
-    bool has_repeat = false;
-    for (int i = 0; i < input.length(); i++) {
-      if (i + 1 < input.length() && !has_separate_doubles) {
-        std::string substr = input.substr(i, 2);
-        auto it = pair_starting_positions.find(substr);
-        if (it != pair_starting_positions.end()) {
-          if (i - it->second > 1) {
-            has_separate_doubles = true;
-          }
-        } else {
-          pair_starting_positions.insert(
-              std::pair<std::string, int>(substr, {i}));
+bool IsBetterNice(std::string_view input) {
+  std::unordered_map<std::string_view, int> pair_starting_positions;
+  bool has_separate_doubles = false;
+  bool has_repeat = false;
+  for (int i = 0; i < input.length(); i++) {
+    if (i + 1 < input.length() && !has_separate_doubles) {
+      std::string_view substr = input.substr(i, 2);
+      auto it = pair_starting_positions.find(substr);
+      if (it != pair_starting_positions.end()) {
+        if (i - it->second > 1) {
+          has_separate_doubles = true;
         }
+      } else {
+        pair_starting_positions.insert({substr, i});
       }
+    }
 
-      if (i + 2 < input.length() && !has_repeat) {
-        if (input[i + 2] == input[i]) {
-          has_repeat = true;
-        }
-      }
-      if (has_repeat && has_separate_doubles) {
-        nice_count++;
-        break;
+    if (i + 2 < input.length() && !has_repeat) {
+      if (input[i + 2] == input[i]) {
+        has_repeat = true;
       }
     }
+    if (has_repeat && has_separate_doubles) {
+      return true;
+    }
   }
-  return nice_count;
+  return false;
+}
+
+int NumOfNiceStrings(const std::vector<std::string>& inputs) {
+  return std::count_if(inputs.begin(), inputs.end(),
+                       [](const std::string& input) { return IsNice(input); });
 }
 
-int main() {
-  std::vector<std::string> inputs =
-      aoc::LoadStringsFromFileByLine("./2015/day5.txt");
+int NumOfBetterNiceStrings(const std::vector<std::string>& inputs) {
+  return std::count_if(inputs.begin(), inputs.end(),
+                       [](const std::string& input) {
+                         return IsBetterNice(input);
+                       });
+}
 
+void Examples() {
   assert(NumOfNiceStrings({"ugknbfddgicrmopn"}) == 1);
   assert(NumOfNiceStrings({"aaa"}) == 1);
   assert(NumOfNiceStrings({"jchzalrnumimnmhp"}) == 0);
   assert(NumOfNiceStrings({"haegwjzuvuyypxyu"}) == 0);
   assert(NumOfNiceStrings({"dvszwmarrgswjxmb"}) == 0);
 
-  int count = NumOfNiceStrings(inputs);
-
   assert(NumOfBetterNiceStrings({"qjhvhtzxzqqjkmpb"}) == 1);
   assert(NumOfBetterNiceStrings({"xxyxx"}) == 1);
   assert(NumOfBetterNiceStrings({"uurcxstgmygtbstg"}) == 0);
   assert(NumOfBetterNiceStrings({"ieodomkazucvgmuy"}) == 0);
   assert(NumOfBetterNiceStrings({"cqfikbgxvjmnfncy"}) == 0);
+}
 
-  int better_count = NumOfBetterNiceStrings(inputs);
+// How many strings pass the part 1 rules and the part 2 rules.
+struct Counts {
+  int64_t nice = 0;
+  int64_t better_nice = 0;
+};
+
+Counts Parse(aoc::LineStream& lines) {
+  Counts counts;
+  while (std::optional<std::string_view> line = lines.Next()) {
+    counts.nice += IsNice(*line);
+    counts.better_nice += IsBetterNice(*line);
+  }
+  return counts;
+}
 
-  std::cout << "Number of Better Nice Strings: " << better_count << "\n";
-  std::cout << "Number of Nice Strings: " << count << "\n";
+int64_t Part1(const Counts& counts) { return counts.nice; }
 
-  return 0;
-}
+int64_t Part2(const Counts& counts) { return counts.better_nice; }
+
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2015,
+                  .day = 5,
+                  .input_file = "./2015/day5.txt",
+                  .examples = Examples},
+                 Parse, Part1, Part2);
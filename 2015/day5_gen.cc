@@ -0,0 +1,24 @@
+// Generates 2015 day 5 inputs: --size strings of 16 lowercase letters.
+
+#include <cstdint>
+
+#include "utils/gen.h"
+
+namespace {
+
+void Generate(aoc::Generator& gen) {
+  constexpr char kLetters[] = "abcdefghijklmnopqrstuvwxyz";
+  for (int64_t i = 0; i < gen.size(); ++i) {
+    for (int c = 0; c < 16; ++c) {
+      gen.Write(gen.Pick(kLetters));
+    }
+    gen.Write('\n');
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  return aoc::RunGenerator(
+      argc, argv, {.default_size = 1000, .size_unit = "strings"}, Generate);
+}
@@ -53,13 +53,17 @@ For example:
 
 */
 #include <cassert>
-#include <iostream>
 #include <numeric>
-#include <regex>
+#include <optional>
+#include <string_view>
 #include <vector>
 
+#include "utils/day.h"
+#include "utils/extract_ints.h"
 #include "utils/utils.h"
 
+namespace {
+
 enum class Action {
   kOn,
   kOff,
@@ -90,43 +94,26 @@ Grid InitLightGrid() {
   }
   return grid;
 }
-// Function to convert action string to Action enum
-Action StringToAction(const std::string& actionStr) {
-  if (actionStr == "turn on") {
-    return Action::kOn;
-  } else if (actionStr == "turn off") {
-    return Action::kOff;
-  } else if (actionStr == "toggle") {
-    return Action::kToggle;
-  } else {
-    exit(1);
-  }
+// The action a line starts with, or std::nullopt for a line with none.
+std::optional<Action> ParseAction(std::string_view line) {
+  if (line.starts_with("turn on")) return Action::kOn;
+  if (line.starts_with("turn off")) return Action::kOff;
+  if (line.starts_with("toggle")) return Action::kToggle;
+  return std::nullopt;
 }
 
 // Function to parse a string and return a vector of CoordinateRect
-std::vector<CoordinateRect> ParseInput(const std::string& input) {
-  std::vector<CoordinateRect> result;
-  std::regex re(R"((turn on|turn off|toggle) (\d+),(\d+) through (\d+),(\d+))");
-  std::smatch match;
-  std::string::const_iterator searchStart(input.cbegin());
-
-  while (std::regex_search(searchStart, input.cend(), match, re)) {
-    CoordinateRect rect;
-    rect.action = StringToAction(match[1].str());
-    rect.x1 = std::stoi(match[2].str());
-    rect.y1 = std::stoi(match[3].str());
-    rect.x2 = std::stoi(match[4].str());
-    rect.y2 = std::stoi(match[5].str());
-    result.push_back(rect);
-    searchStart = match.suffix().first;
+void ParseInput(std::string_view input, std::vector<CoordinateRect>& result) {
+  result.clear();
+  for (std::string_view line : aoc::Split(input, "\n")) {
+    std::optional<Action> action = ParseAction(line);
+    if (!action.has_value()) {
+      continue;
+    }
+    auto [x1, y1, x2, y2] = aoc::ExtractInts<4, int>(line);
+    result.push_back(
+        {.x1 = x1, .y1 = y1, .x2 = x2, .y2 = y2, .action = *action});
   }
-
-  return result;
-}
-std::vector<CoordinateRect> ParseCoordinates() {
-  std::string inputs = aoc::ReadFileToString("./2015/day6.txt");
-
-  return ParseInput(inputs);
 }
 
 void ApplyRect(Grid& grid, const CoordinateRect& rect) {
@@ -176,7 +163,8 @@ int CountOnLights(const Grid& grid) {
 
 bool Test(std::string command, int expected_on, int expected_brightness) {
   Grid grid = InitLightGrid();
-  auto rects = ParseInput(command);
+  std::vector<CoordinateRect> rects;
+  ParseInput(command, rects);
   for (const auto& rect : rects) {
     ApplyRect(grid, rect);
   }
@@ -184,22 +172,39 @@ bool Test(std::string command, int expected_on, int expected_brightness) {
          CountBrightness(grid) == expected_brightness;
 }
 
-int main() {
-  auto grid = InitLightGrid();
+void Examples() {
+  assert(Test("turn on 0,0 through 999,999", 1000000, 1000000));
+  assert(Test("toggle 0,0 through 999,0", 1000, 2000));
+  assert(Test("turn on 499,499 through 500,500\n"
+              "turn on 499,499 through 500,500",
+              4, 8));
+}
 
-  std::vector<CoordinateRect> rects = ParseCoordinates();
+// Refills `rects` in place, so a Day reused across inputs keeps the vector.
+void Parse(std::string_view input, std::vector<CoordinateRect>& rects) {
+  ParseInput(input, rects);
+}
 
+Grid ApplyAll(const std::vector<CoordinateRect>& rects) {
+  Grid grid = InitLightGrid();
   for (const auto& rec : rects) {
     ApplyRect(grid, rec);
   }
+  return grid;
+}
 
-  assert(Test("turn on 0,0 through 999,999", 1000000, 1000000));
-  assert(Test("toggle 0,0 through 999,0", 1000, 2000));
-  assert(Test("turn on 499,499 through 500,500 turn on 499,499 through 500,500",
-              4, 8));
-
-  std::cout << "On count: " << CountOnLights(grid) << std::endl;
-  std::cout << "Brightness: " << CountBrightness(grid) << std::endl;
+int Part1(const std::vector<CoordinateRect>& rects) {
+  return CountOnLights(ApplyAll(rects));
+}
 
-  return 0;
+int Part2(const std::vector<CoordinateRect>& rects) {
+  return CountBrightness(ApplyAll(rects));
 }
+
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2015,
+                  .day = 6,
+                  .input_file = "./2015/day6.txt",
+                  .examples = Examples},
+                 Parse, Part1, Part2);
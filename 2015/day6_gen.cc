@@ -0,0 +1,29 @@
+// Generates 2015 day 6 inputs: --size instructions over the 1000x1000 grid.
+
+#include <algorithm>
+#include <cstdint>
+
+#include "utils/gen.h"
+
+namespace {
+
+void Generate(aoc::Generator& gen) {
+  constexpr const char* kActions[] = {"turn on", "turn off", "toggle"};
+  for (int64_t i = 0; i < gen.size(); ++i) {
+    int64_t x1 = gen.Uniform(0, 999);
+    int64_t x2 = gen.Uniform(0, 999);
+    int64_t y1 = gen.Uniform(0, 999);
+    int64_t y2 = gen.Uniform(0, 999);
+    gen.Print("{} {},{} through {},{}\n", kActions[gen.Uniform(0, 2)],
+              std::min(x1, x2), std::min(y1, y2), std::max(x1, x2),
+              std::max(y1, y2));
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  return aoc::RunGenerator(
+      argc, argv, {.default_size = 300, .size_unit = "instructions"},
+      Generate);
+}
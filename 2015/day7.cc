@@ -51,53 +51,61 @@ In little Bobby's kit's instructions booklet (provided as your puzzle input),
 what signal is ultimately provided to wire a?
 */
 
-#include <iostream>
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
 #include <optional>
 #include <ostream>
 #include <regex>
 #include <stack>
 #include <string>
-#include <unordered_map>
+#include <string_view>
 #include <vector>
 
+#include "absl/log/check.h"
+#include "utils/day.h"
+#include "utils/interner.h"
 #include "utils/utils.h"
 
+namespace {
+
 struct Node {
-  uint16_t value = 0;
-  std::string name;
-  std::vector<Node*> neighbors;
+  // Ids of the wires this one reads.
+  std::vector<int> neighbors;
   std::string instruction;
+  // The number in the instruction, if it has one: a shift amount or a
+  // constant.
+  uint16_t literal = 0;
 };
 
 class Graph {
  public:
+  // nodes[id] is the wire with that id in `wires`.
+  aoc::Interner wires;
   std::vector<Node> nodes;
+  // Every wire id, each after the wires it reads.
+  std::vector<int> build_order;
 
-  void AddNode(Node node) { nodes.push_back(node); }
-
-  void AddEdges(std::string from, std::string to) {
-    Node& from_node =
-        *std::find_if(nodes.begin(), nodes.end(),
-                      [from](const Node& node) { return node.name == from; });
-    Node& to_node =
-        *std::find_if(nodes.begin(), nodes.end(),
-                      [to](const Node& node) { return node.name == to; });
-
-    from_node.neighbors.push_back(&to_node);
+  void AddNode(std::string_view name, std::string instruction) {
+    int id = wires.Intern(name);
+    if (id >= nodes.size()) {
+      nodes.resize(id + 1);
+    }
+    nodes[id].instruction = std::move(instruction);
   }
 
-  std::vector<std::string> StartTopologicalSort() {
-    std::unordered_map<std::string, bool> visited;
-    std::stack<std::string> stack;
-    std::vector<std::string> result;
+  void AddEdges(std::string_view from, std::string_view to) {
+    nodes[FindId(from)].neighbors.push_back(FindId(to));
+  }
 
-    for (const auto& node : nodes) {
-      visited[node.name] = false;
-    }
+  std::vector<int> StartTopologicalSort() const {
+    std::vector<bool> visited(nodes.size(), false);
+    std::stack<int> stack;
+    std::vector<int> result;
 
-    for (const auto& node : nodes) {
-      if (!visited[node.name]) {
-        TopologicalSort(node, visited, stack);
+    for (int id = 0; id < nodes.size(); ++id) {
+      if (!visited[id]) {
+        TopologicalSort(id, visited, stack);
       }
     }
 
@@ -110,141 +118,134 @@ class Graph {
     return result;
   }
 
-  void TopologicalSort(const Node& node,
-                       std::unordered_map<std::string, bool>& visited,
-                       std::stack<std::string>& stack) {
-    visited[node.name] = true;
+  void TopologicalSort(int id, std::vector<bool>& visited,
+                       std::stack<int>& stack) const {
+    visited[id] = true;
 
-    for (const auto& neighbor : node.neighbors) {
-      if (!visited[neighbor->name]) {
-        TopologicalSort(*neighbor, visited, stack);
+    for (int neighbor : nodes[id].neighbors) {
+      if (!visited[neighbor]) {
+        TopologicalSort(neighbor, visited, stack);
       }
     }
 
-    stack.push(node.name);
+    stack.push(id);
   }
 
-  void ComputeNode(std::string name) {
-    Node* node = nullptr;
-    // Gets a pointer to our node.
-    for (Node& temp_node : nodes) {
-      if (temp_node.name == name) {
-        node = &temp_node;
-      }
-    }
+  // The signal on wire `id`, given `values` for every wire it reads.
+  uint16_t ComputeNode(int id, const std::vector<uint16_t>& values) const {
+    const Node& node = nodes[id];
+    auto neighbor = [&](int i) { return values[node.neighbors[i]]; };
     // If the node operation is the NOT operation.
-    if (node->instruction.starts_with("NOT")) {
-      node->value = ~node->neighbors[0]->value;
-
+    if (node.instruction.starts_with("NOT")) {
+      return ~neighbor(0);
     }
     // If the node operation is the AND operation.
-    else if (node->instruction.find("AND") != std::string::npos) {
+    if (node.instruction.find("AND") != std::string::npos) {
       // If the node has 2 neighbors, apply the operation on those 2.
-      if (node->neighbors.size() == 2) {
-        node->value = node->neighbors[0]->value & node->neighbors[1]->value;
+      if (node.neighbors.size() == 2) {
+        return neighbor(0) & neighbor(1);
       }
       // With our input, we always have at least 1 neighbor which means we just
       // have to search for the other constant in the instruction.
-      else {
-        node->value = node->neighbors[0]->value & 1;
-      }
+      return neighbor(0) & 1;
     }
     // If the node operation is the OR operation.
-    else if (node->instruction.find("OR") != std::string::npos) {
-      node->value = node->neighbors[0]->value | node->neighbors[1]->value;
+    if (node.instruction.find("OR") != std::string::npos) {
+      return neighbor(0) | neighbor(1);
     }
     // If the node operation is the LSHIFT operation.
-    else if (node->instruction.find("LSHIFT") != std::string::npos) {
-      std::regex number_pattern("\\d+");
-      std::smatch match;
-      std::regex_search(node->instruction, match, number_pattern);
-
-      node->value = node->neighbors[0]->value << std::stoi(match[0]);
+    if (node.instruction.find("LSHIFT") != std::string::npos) {
+      return neighbor(0) << node.literal;
     }
     // If the node operation is the RSHIFT operation.
-    else if (node->instruction.find("RSHIFT") != std::string::npos) {
-      std::regex number_pattern("\\d+");
-      std::smatch match;
-      std::regex_search(node->instruction, match, number_pattern);
-
-      node->value = node->neighbors[0]->value >> std::stoi(match[0]);
-    }
-    // The default operation is an assignment operation.
-    else {
-      // If we have a neighbor, assign the neighbors value to this node
-      if (node->neighbors.size() == 1) {
-        node->value = node->neighbors[0]->value;
-        // Search for a constant value in the instruction and assign that value
-        // to the node.
-      } else {
-        std::regex number_pattern("\\d+");
-        std::smatch match;
-        std::regex_search(node->instruction, match, number_pattern);
-
-        node->value = std::stoi(match[0]);
-      }
+    if (node.instruction.find("RSHIFT") != std::string::npos) {
+      return neighbor(0) >> node.literal;
     }
+    // The default operation is an assignment operation: from the neighbor if
+    // there is one, otherwise from the constant in the instruction.
+    return node.neighbors.size() == 1 ? neighbor(0) : node.literal;
   }
-  Node& FindNode(std::string node_name) {
-    return *std::find_if(
-        nodes.begin(), nodes.end(),
-        [node_name](const Node& node) { return node.name == node_name; });
+
+  int FindId(std::string_view name) const {
+    std::optional<int> id = wires.Find(name);
+    CHECK(id.has_value()) << "No wire " << name;
+    return *id;
   }
 };
 
-Graph BuildGraph(const std::string& input) {
+Graph BuildGraph(std::string_view input) {
   Graph graph;
-  std::smatch match;
-  std::string::const_iterator searchStart(input.cbegin());
+  std::cmatch match;
+  const char* search_start = input.data();
+  const char* input_end = input.data() + input.size();
   std::regex re(R"((.*) -> (\w+))");
 
-  while (std::regex_search(searchStart, input.cend(), match, re)) {
-    graph.AddNode({.name = match[2], .instruction = match[1]});
+  while (std::regex_search(search_start, input_end, match, re)) {
+    graph.AddNode(match[2].str(), match[1].str());
 
-    searchStart = match.suffix().first;
+    search_start = match.suffix().first;
   }
 
-  for (const auto& node : graph.nodes) {
+  std::smatch wire_match;
+  for (int id = 0; id < graph.nodes.size(); ++id) {
+    Node& node = graph.nodes[id];
     std::string::const_iterator instruction_search_start(
         node.instruction.cbegin());
 
     std::regex re2(
         R"(\b(?!AND\b)(?!OR\b)(?!NOT\b)(?!RSHIFT\b)(?!LSHIFT\b)[a-z]+\b)");
     while (std::regex_search(instruction_search_start, node.instruction.cend(),
-                             match, re2)) {
-      graph.AddEdges(node.name, match[0].str());
+                             wire_match, re2)) {
+      graph.AddEdges(graph.wires.Name(id), wire_match[0].str());
+
+      instruction_search_start = wire_match.suffix().first;
+    }
 
-      instruction_search_start = match.suffix().first;
+    size_t digits = node.instruction.find_first_of("0123456789");
+    if (digits != std::string::npos) {
+      std::from_chars(node.instruction.data() + digits,
+                      node.instruction.data() + node.instruction.size(),
+                      node.literal);
     }
   }
 
+  graph.build_order = graph.StartTopologicalSort();
   return graph;
 }
 
-int main() {
-  std::string input = aoc::ReadFileToString("./2015/day7.txt");
-  Graph graph = BuildGraph(input);
-  std::vector<std::string> build_order = graph.StartTopologicalSort();
+// The circuit is interned and sorted once. The parts only fill in a vector of
+// wire values indexed by id.
+Graph Parse(std::string_view input) { return BuildGraph(input); }
 
-  for (auto& name : build_order) {
-    graph.ComputeNode(name);
+// Computes every wire but `skip` into `values`, in build order.
+void ComputeCircuit(const Graph& graph, std::vector<uint16_t>& values,
+                    int skip = -1) {
+  for (int id : graph.build_order) {
+    if (id != skip) {
+      values[id] = graph.ComputeNode(id, values);
+    }
   }
+}
 
-  Node& nodeA = graph.FindNode("a");
-  Node& nodeB = graph.FindNode("b");
-
-  std::cout << "A node: " << nodeA.value << std::endl;
-
-  // PART 2
-  build_order.erase(build_order.begin());
+uint16_t Part1(const Graph& graph) {
+  std::vector<uint16_t> values(graph.nodes.size());
+  ComputeCircuit(graph, values);
+  return values[graph.FindId("a")];
+}
 
-  nodeB.value = nodeA.value;
+uint16_t Part2(const Graph& graph) {
+  std::vector<uint16_t> values(graph.nodes.size());
+  ComputeCircuit(graph, values);
 
-  for (auto& name : build_order) {
-    graph.ComputeNode(name);
-  }
+  // Override wire b with a's signal and let everything else settle again.
+  const int a = graph.FindId("a");
+  const int b = graph.FindId("b");
+  values[b] = values[a];
+  ComputeCircuit(graph, values, /*skip=*/b);
+  return values[a];
+}
 
-  std::cout << "New A: " << nodeA.value << std::endl;
+}  // namespace
 
-  return 0;
-}
+AOC_REGISTER_DAY({.year = 2015, .day = 7, .input_file = "./2015/day7.txt"},
+                 Parse, Part1, Part2);
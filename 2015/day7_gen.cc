@@ -0,0 +1,87 @@
+// Generates 2015 day 7 inputs: a circuit of --size gates, in shuffled order.
+//
+// Every gate reads wires defined before it, so the circuit is acyclic. As in
+// the real puzzle, wire "b" is a signal that many gates read and wire "a" is
+// the last gate, which also reads "b" shifted left, so overriding "b" in
+// part 2 changes "a".
+
+#include <algorithm>
+#include <cstdint>
+#include <format>
+#include <string>
+#include <vector>
+
+#include "utils/gen.h"
+
+namespace {
+
+// "aa", "ab", ..., "zz", "baa", ... Never one letter, so never "a" or "b".
+std::string WireName(int64_t index) {
+  std::string name;
+  do {
+    name.insert(name.begin(), 'a' + index % 26);
+    index /= 26;
+  } while (index > 0);
+  if (name.size() < 2) name.insert(name.begin(), 'a');
+  return name;
+}
+
+void Generate(aoc::Generator& gen) {
+  const int64_t num_gates = std::max<int64_t>(gen.size(), 4);
+  const int64_t num_signals = std::max<int64_t>(num_gates / 20, 2);
+  std::vector<std::string> wires;
+  std::vector<std::string> lines;
+  auto wire = [&] {
+    return gen.Chance(0.1) ? std::string("b")
+                           : wires[gen.Uniform(0, wires.size() - 1)];
+  };
+
+  for (int64_t i = 0; i < num_gates; ++i) {
+    std::string out = i == 1               ? "b"
+                      : i == num_gates - 1 ? "a"
+                                           : WireName(i);
+    if (i == num_gates - 2) {
+      lines.push_back(std::format("b LSHIFT 1 -> {}", out));
+    } else if (i == num_gates - 1) {
+      lines.push_back(std::format("{} OR {} -> a", wires.back(), wire()));
+    } else if (i < num_signals) {
+      lines.push_back(std::format("{} -> {}", gen.Uniform(0, 65535), out));
+    } else {
+      switch (gen.Uniform(0, 5)) {
+        case 0:
+          lines.push_back(std::format("{} AND {} -> {}", wire(), wire(), out));
+          break;
+        case 1:
+          lines.push_back(std::format("1 AND {} -> {}", wire(), out));
+          break;
+        case 2:
+          lines.push_back(std::format("{} OR {} -> {}", wire(), wire(), out));
+          break;
+        case 3:
+          lines.push_back(std::format("{} LSHIFT {} -> {}", wire(),
+                                      gen.Uniform(1, 15), out));
+          break;
+        case 4:
+          lines.push_back(std::format("{} RSHIFT {} -> {}", wire(),
+                                      gen.Uniform(1, 15), out));
+          break;
+        default:
+          lines.push_back(std::format("NOT {} -> {}", wire(), out));
+      }
+    }
+    wires.push_back(out);
+  }
+
+  gen.Shuffle(lines);
+  for (const std::string& line : lines) {
+    gen.Write(line);
+    gen.Write('\n');
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  return aoc::RunGenerator(
+      argc, argv, {.default_size = 339, .size_unit = "gates"}, Generate);
+}
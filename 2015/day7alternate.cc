@@ -56,17 +56,13 @@ to wire a?
 
 #include <optional>
 #include <regex>
+#include <string_view>
 
 #include "absl/container/flat_hash_map.h"
+#include "utils/day.h"
 #include "utils/utils.h"
 
-void PrettyPrintWires(const absl::flat_hash_map<std::string, uint16_t>& wires) {
-  std::cout << "{\n";
-  for (const auto& pair : wires) {
-    std::cout << "  \"" << pair.first << "\": " << pair.second << ",\n";
-  }
-  std::cout << "}\n";
-}
+namespace {
 
 enum class Operation {
   kAnd,
@@ -99,14 +95,6 @@ class Operand {
     return literal_value.has_value() || wires.contains(wire);
   }
 
-  std::string ToString() const {
-    if (literal_value) {
-      return std::to_string(*literal_value);
-    } else {
-      return wire;
-    }
-  }
-
   uint16_t Value(absl::flat_hash_map<std::string, uint16_t>& wires) const {
     if (literal_value) {
       return *literal_value;
@@ -134,35 +122,6 @@ struct Instruction {
                                       return op.CanExecute(wires);
                                     });
   }
-  void PrettyPrint() const {
-    std::cout << "Operation: " << OperationToString(operation) << "\n";
-    std::cout << "Operands: ";
-    for (const auto& operand : operands) {
-      std::cout << operand.ToString() << " ";
-    }
-    std::cout << "\nDestination: " << destination << "\n";
-    std::cout << "Executed: " << (executed ? "true" : "false") << "\n";
-  }
-
- private:
-  static std::string OperationToString(Operation op) {
-    switch (op) {
-      case Operation::kAnd:
-        return "AND";
-      case Operation::kOr:
-        return "OR";
-      case Operation::kNot:
-        return "NOT";
-      case Operation::kLshift:
-        return "LSHIFT";
-      case Operation::kRshift:
-        return "RSHIFT";
-      case Operation::kAssignment:
-        return "ASSIGNMENT";
-      default:
-        return "UNKNOWN";
-    }
-  }
 };
 
 // Executes if possible. Returns true if so.
@@ -221,7 +180,7 @@ Operation StringToOperation(const std::string& operation) {
   return Operation::kOr;
 }
 
-std::vector<Instruction> ParseInstructions() {
+std::vector<Instruction> Parse(std::string_view input) {
   std::regex re(
       R"(((\w+)\s+(\w+)\s+(\w+)\s+->\s+(\w+))|(NOT\s+(\w+)\s+->\s+(\w+))|((\w+)\s+->\s+(\w+)))");
   constexpr int kIsBinary = 1;
@@ -236,8 +195,7 @@ std::vector<Instruction> ParseInstructions() {
   constexpr int kAssignmentOp = 10;
   constexpr int kAssignmentDest = 11;
 
-  std::vector<std::string> lines =
-      aoc::LoadStringsFromFileByLine("./2015/day7alternate.txt");
+  std::vector<std::string> lines = aoc::SplitLines(input);
 
   std::vector<Instruction> instructions;
 
@@ -260,20 +218,17 @@ std::vector<Instruction> ParseInstructions() {
              .operands = {Operand(match[kAssignmentOp].str())},
              .destination = match[kAssignmentDest].str()});
       } else {
-        std::cout << "No match found for: " << line << std::endl;
+        AOC_LOG(ERROR, "No match found for: {}", line);
       }
     }
   }
   return instructions;
 }
 
-int main() {
-  std::vector<Instruction> instructions = ParseInstructions();
-
-  // If a wire has a known value, it is recorded here.
-  absl::flat_hash_map<std::string, uint16_t> wires;
-
-  // Repeat until all instructions are executed.
+// Repeats until all instructions are executed, recording wire values in
+// `wires`.
+void ExecuteAll(std::vector<Instruction>& instructions,
+                absl::flat_hash_map<std::string, uint16_t>& wires) {
   while (!std::all_of(
       instructions.begin(), instructions.end(),
       [](const Instruction& instruction) { return instruction.executed; })) {
@@ -282,32 +237,40 @@ int main() {
       TryExecute(instruction, wires);
     }
   }
-  std::cout << "Wire a: " << wires["a"] << std::endl;
+}
+
+uint16_t Part1(const std::vector<Instruction>& parsed) {
+  std::vector<Instruction> instructions = parsed;
 
   // If a wire has a known value, it is recorded here.
-  absl::flat_hash_map<std::string, uint16_t> part_two_wires;
+  absl::flat_hash_map<std::string, uint16_t> wires;
+  ExecuteAll(instructions, wires);
+  return wires["a"];
+}
 
-  // Mark the wire b with the value from a.
-  part_two_wires["b"] = wires["a"];
+uint16_t Part2(const std::vector<Instruction>& parsed) {
+  std::vector<Instruction> instructions = parsed;
 
-  std::for_each(instructions.begin(), instructions.end(),
-                [](Instruction& instruction) {
-                  // Reset every instruction except the one that assigns b.
-                  if (instruction.destination != "b") {
-                    instruction.executed = false;
-                  }
-                });
+  // If a wire has a known value, it is recorded here.
+  absl::flat_hash_map<std::string, uint16_t> wires;
 
-  // Repeat until all instructions are executed.
-  while (!std::all_of(
-      instructions.begin(), instructions.end(),
-      [](const Instruction& instruction) { return instruction.executed; })) {
-    // Try to execute each instruction.
-    for (Instruction& instruction : instructions) {
-      TryExecute(instruction, part_two_wires);
+  // Mark the wire b with the value from a.
+  wires["b"] = Part1(parsed);
+
+  // Skip the instruction that assigns b.
+  for (Instruction& instruction : instructions) {
+    if (instruction.destination == "b") {
+      instruction.executed = true;
     }
   }
-  std::cout << "Part 2 wire a: " << part_two_wires["a"] << std::endl;
-
-  return 0;
+  ExecuteAll(instructions, wires);
+  return wires["a"];
 }
+
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2015,
+                  .day = 7,
+                  .input_file = "./2015/day7alternate.txt",
+                  .variant = "alternate"},
+                 Parse, Part1, Part2);
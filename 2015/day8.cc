@@ -57,14 +57,19 @@ like in the first part of this puzzle) is 42 - 23 = 19.
 */
 #include <algorithm>
 #include <cassert>
-#include <iostream>
-#include <ostream>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
 
+#include "absl/log/check.h"
+#include "utils/day.h"
+#include "utils/embedded_input.h"
+#include "utils/line_stream.h"
 #include "utils/utils.h"
 
+namespace {
+
 size_t ComputeEncodedSize(std::string_view str) {
   size_t encoded_size = str.size();
   // This should always be true.
@@ -126,44 +131,54 @@ struct TotalSizes {
   size_t encoded_size = 0;
 };
 
-TotalSizes ComputeSizes(std::vector<std::string>& strings) {
-  TotalSizes sizes;
-  // Strip whitespace first.
-  aoc::StripWhitespace(strings);
+void AddSizes(std::string_view str, TotalSizes& sizes) {
+  sizes.code_size += str.size();
+  sizes.in_memory_size += ComputeInMemorySize(str);
+  sizes.encoded_size += ComputeEncodedSize(str);
+}
 
-  sizes.code_size = aoc::TotalSize(strings);
-  sizes.in_memory_size = 0;
+TotalSizes ComputeSizes(const std::vector<std::string>& strings) {
+  TotalSizes sizes;
   for (const std::string& str : strings) {
-    sizes.in_memory_size += ComputeInMemorySize(str);
-    sizes.encoded_size += ComputeEncodedSize(str);
+    AddSizes(str, sizes);
   }
-
   return sizes;
 }
 
 bool Test() {
-  std::vector<std::string> strings =
-      aoc::LoadStringsFromFileByLine("./2015/day8test.txt");
+  std::optional<std::string_view> input =
+      aoc::FindEmbeddedInput("2015/day8test.txt");
+  CHECK(input.has_value()) << "2015/day8test.txt is not embedded";
+  std::vector<std::string> strings = aoc::SplitLines(*input);
+  aoc::StripWhitespace(strings);
   TotalSizes sizes = ComputeSizes(strings);
   return sizes.code_size == 23 && sizes.in_memory_size == 11 &&
          sizes.encoded_size == 42;
 }
 
-int main() {
-  assert(Test());
-
-  std::vector<std::string> strings =
-      aoc::LoadStringsFromFileByLine("./2015/day8.txt");
-  TotalSizes sizes = ComputeSizes(strings);
+void Examples() { assert(Test()); }
 
-  std::cout << "Code size = " << sizes.code_size
-            << " In memory size = " << sizes.in_memory_size
-            << " Encoded size = " << sizes.encoded_size << "\n";
+// The parts only need the three sizes summed over every line.
+TotalSizes Parse(aoc::LineStream& lines) {
+  TotalSizes sizes;
+  while (std::optional<std::string_view> line = lines.Next()) {
+    AddSizes(aoc::TrimWhitespace(*line), sizes);
+  }
+  return sizes;
+}
 
-  std::cout << "Original minus in-memory = "
-            << (sizes.code_size - sizes.in_memory_size)
-            << " Encoded minus original: "
-            << (sizes.encoded_size - sizes.code_size) << "\n";
+size_t Part1(const TotalSizes& sizes) {
+  return sizes.code_size - sizes.in_memory_size;
+}
 
-  return 0;
+size_t Part2(const TotalSizes& sizes) {
+  return sizes.encoded_size - sizes.code_size;
 }
+
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2015,
+                  .day = 8,
+                  .input_file = "./2015/day8.txt",
+                  .examples = Examples},
+                 Parse, Part1, Part2);
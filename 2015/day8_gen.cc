@@ -0,0 +1,37 @@
+// Generates 2015 day 8 inputs: --size quoted strings of letters mixed with \\,
+// \" and \xNN escapes.
+
+#include <cstdint>
+
+#include "utils/gen.h"
+
+namespace {
+
+void Generate(aoc::Generator& gen) {
+  constexpr char kLetters[] = "abcdefghijklmnopqrstuvwxyz";
+  constexpr char kHex[] = "0123456789abcdef";
+  for (int64_t i = 0; i < gen.size(); ++i) {
+    gen.Write('"');
+    const int64_t length = gen.Uniform(1, 30);
+    for (int64_t c = 0; c < length; ++c) {
+      const int64_t roll = gen.Uniform(0, 19);
+      if (roll == 0) {
+        gen.Write("\\\\");
+      } else if (roll == 1) {
+        gen.Write("\\\"");
+      } else if (roll == 2) {
+        gen.Print("\\x{}{}", gen.Pick(kHex), gen.Pick(kHex));
+      } else {
+        gen.Write(gen.Pick(kLetters));
+      }
+    }
+    gen.Write("\"\n");
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  return aoc::RunGenerator(
+      argc, argv, {.default_size = 300, .size_unit = "strings"}, Generate);
+}
@@ -39,58 +39,49 @@ What is the distance of the longest route?
 */
 
 #include <climits>
-#include <iostream>
-#include <regex>
 #include <string>
-#include <unordered_map>
+#include <string_view>
 #include <vector>
 
+#include "absl/log/check.h"
+#include "utils/day.h"
+#include "utils/interner.h"
+#include "utils/scan.h"
 #include "utils/utils.h"
 
-std::vector<std::vector<int>> BuildMatrix(
-    std::vector<std::string> lines,
-    const std::unordered_map<std::string, int>& map) {
-  int length = map.size();
-  std::vector<std::vector<int>> matrix(length, std::vector<int>(length));
-
-  for (const auto& line : lines) {
-    std::regex number_pattern(R"((\w+) to (\w+) = (\d+))");
-    std::smatch match;
-    std::regex_search(line, match, number_pattern);
-
-    std::string from_name = match[1];
-    std::string to_name = match[2];
+namespace {
 
-    int from_int = map.at(from_name);
-    int to_int = map.at(to_name);
-    matrix[from_int][to_int] = std::stoi(match[3]);
-    matrix[to_int][from_int] = std::stoi(match[3]);
-  }
-  return matrix;
+// Parses "London to Dublin = 464".
+auto ParseLine(std::string_view line) {
+  auto match =
+      aoc::Scan<"{} to {} = {}", std::string_view, std::string_view, int>(
+          line);
+  CHECK(match.has_value()) << "Bad line: " << line;
+  return *match;
 }
 
-std::unordered_map<std::string, int> BuildStringMap(
-    std::vector<std::string> lines) {
-  int id = 0;
-  std::unordered_map<std::string, int> map;
+std::vector<std::vector<int>> BuildMatrix(
+    const std::vector<std::string>& lines) {
+  struct Edge {
+    int from;
+    int to;
+    int distance;
+  };
+  aoc::Interner places;
+  std::vector<Edge> edges;
   for (const auto& line : lines) {
-    std::regex number_pattern(R"((\w+) to (\w+) = (\d+))");
-    std::smatch match;
-    std::regex_search(line, match, number_pattern);
-
-    std::string from_name = match[1];
-    std::string to_name = match[2];
+    auto [from_name, to_name, distance] = ParseLine(line);
+    edges.push_back({places.Intern(from_name), places.Intern(to_name),
+                     distance});
+  }
 
-    if (map.find(from_name) == map.end()) {
-      map.insert({from_name, id});
-      id++;
-    }
-    if (map.find(to_name) == map.end()) {
-      map.insert({to_name, id});
-      id++;
-    }
+  int length = places.size();
+  std::vector<std::vector<int>> matrix(length, std::vector<int>(length));
+  for (const Edge& edge : edges) {
+    matrix[edge.from][edge.to] = edge.distance;
+    matrix[edge.to][edge.from] = edge.distance;
   }
-  return map;
+  return matrix;
 }
 
 int MinPath(const std::vector<std::vector<int>>& graph, int s) {
@@ -151,14 +142,13 @@ int MaxPath(const std::vector<std::vector<int>>& graph, int s) {
   return max_path;
 }
 
-int main() {
-  std::vector<std::string> lines =
-      aoc::LoadStringsFromFileByLine("./2015/day9.txt");
+using AdjacencyMatrix = std::vector<std::vector<int>>;
 
-  std::unordered_map<std::string, int> string_map = BuildStringMap(lines);
-  std::vector<std::vector<int>> adjacency_matrix =
-      BuildMatrix(lines, string_map);
+AdjacencyMatrix Parse(std::string_view input) {
+  return BuildMatrix(aoc::SplitLines(input));
+}
 
+int Part1(const AdjacencyMatrix& adjacency_matrix) {
   int min_path = INT_MAX;
   for (int i = 0; i < adjacency_matrix.size(); i++) {
     int temp = MinPath(adjacency_matrix, i);
@@ -166,9 +156,10 @@ int main() {
       min_path = temp;
     }
   }
+  return min_path;
+}
 
-  std::cout << "The minimum path is " << min_path << std::endl;
-
+int Part2(const AdjacencyMatrix& adjacency_matrix) {
   int max_path = INT_MIN;
   for (int i = 0; i < adjacency_matrix.size(); i++) {
     int temp = MaxPath(adjacency_matrix, i);
@@ -176,8 +167,10 @@ int main() {
       max_path = temp;
     }
   }
+  return max_path;
+}
 
-  std::cout << "The maximum path is " << max_path << std::endl;
+}  // namespace
 
-  return 0;
-}
+AOC_REGISTER_DAY({.year = 2015, .day = 9, .input_file = "./2015/day9.txt"},
+                 Parse, Part1, Part2);
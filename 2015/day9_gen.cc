@@ -0,0 +1,24 @@
+// Generates 2015 day 9 inputs: a distance for every pair of --size cities.
+// Both parts try every route, so keep --size small.
+
+#include <cstdint>
+
+#include "utils/gen.h"
+
+namespace {
+
+void Generate(aoc::Generator& gen) {
+  for (int64_t from = 0; from < gen.size(); ++from) {
+    for (int64_t to = from + 1; to < gen.size(); ++to) {
+      gen.Print("City{} to City{} = {}\n", from, to, gen.Uniform(1, 150));
+    }
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  return aoc::RunGenerator(argc, argv,
+                           {.default_size = 8, .size_unit = "cities"},
+                           Generate);
+}
@@ -41,16 +41,19 @@ How many blocks away is the first location you visit twice?
 
 */
 
+#include <optional>
 #include <print>
-
 #include <string>
 #include <string_view>
 #include <vector>
 
 #include "absl/log/check.h"
+#include "utils/day.h"
 #include "utils/status_macros.h"
 #include "utils/utils.h"
 
+namespace {
+
 constexpr int kNumDirections = 4;
 enum Direction {
   kNorth = 0,
@@ -116,28 +119,40 @@ class Coordinate {
   Direction direction_ = Direction::kNorth;
 };
 
-int main() {
-  constexpr std::string_view kInput{
-      "R4, R3, R5, L3, L5, R2, L2, R5, L2, R5, R5, R5, R1, R3, L2, L2, L1, R5, "
-      "L3, R1, L2, R1, L3, L5, L1, R3, L4, R2, R4, L3, L1, R4, L4, R3, L5, L3, "
-      "R188, R4, L1, R48, L5, R4, R71, R3, L2, R188, L3, R2, L3, R3, L5, L1, "
-      "R1, L2, L4, L2, R5, L3, R3, R3, R4, L3, L4, R5, L4, L4, R3, R4, L4, R1, "
-      "L3, L1, L1, R4, R1, L4, R1, L1, L3, R2, L2, R2, L1, R5, R3, R4, L5, R2, "
-      "R5, L5, R1, R2, L1, L3, R3, R1, R3, L4, R4, L4, L1, R1, L2, L2, L4, R1, "
-      "L3, R4, L2, R3, L1, L5, R4, R5, R2, R5, R1, R5, R1, R3, L3, L2, L2, L5, "
-      "R2, L2, R5, R5, L2, R3, L5, R5, L2, R4, R2, L1, R3, L5, R3, R2, R5, L1, "
-      "R3, L2, R2, R1"};
-
-  std::vector<std::string> instructions =
-      aoc::SplitDelimitedString(kInput, ",");
+constexpr std::string_view kInput{
+    "R4, R3, R5, L3, L5, R2, L2, R5, L2, R5, R5, R5, R1, R3, L2, L2, L1, R5, "
+    "L3, R1, L2, R1, L3, L5, L1, R3, L4, R2, R4, L3, L1, R4, L4, R3, L5, L3, "
+    "R188, R4, L1, R48, L5, R4, R71, R3, L2, R188, L3, R2, L3, R3, L5, L1, "
+    "R1, L2, L4, L2, R5, L3, R3, R3, R4, L3, L4, R5, L4, L4, R3, R4, L4, R1, "
+    "L3, L1, L1, R4, R1, L4, R1, L1, L3, R2, L2, R2, L1, R5, R3, R4, L5, R2, "
+    "R5, L5, R1, R2, L1, L3, R3, R1, R3, L4, R4, L4, L1, R1, L2, L2, L4, R1, "
+    "L3, R4, L2, R3, L1, L5, R4, R5, R2, R5, R1, R5, R1, R3, L3, L2, L2, L5, "
+    "R2, L2, R5, R5, L2, R3, L5, R5, L2, R4, R2, L1, R3, L5, R3, R2, R5, L1, "
+    "R3, L2, R2, R1"};
+
+std::vector<std::string> Parse(std::string_view input) {
+  std::vector<std::string> instructions;
+  for (std::string_view instruction : aoc::Split(input, ",")) {
+    instructions.emplace_back(instruction);
+  }
+  return instructions;
+}
 
+int64_t Part1(const std::vector<std::string>& instructions) {
   Coordinate coordinate;
 
   for (std::string_view instruction : instructions) {
     coordinate.ApplyInstruction(instruction);
   }
+  return coordinate.DistanceFromOrigin();
+}
 
-  std::print("Distance from origin: {}\n", coordinate.DistanceFromOrigin());
-
-  return 0;
+// Not solved yet.
+std::optional<int64_t> Part2(const std::vector<std::string>&) {
+  return std::nullopt;
 }
+
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2016, .day = 1, .input_literal = kInput},
+                 Parse, Part1, Part2);
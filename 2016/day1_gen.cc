@@ -0,0 +1,24 @@
+// Generates 2016 day 1 inputs: --size comma-separated turns, each L or R and a
+// distance of 1 to 200 blocks.
+
+#include <cstdint>
+
+#include "utils/gen.h"
+
+namespace {
+
+void Generate(aoc::Generator& gen) {
+  for (int64_t i = 0; i < gen.size(); ++i) {
+    gen.Print("{}{}{}", i > 0 ? ", " : "", gen.Pick("LR"),
+              gen.Uniform(1, 200));
+  }
+  gen.Write('\n');
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  return aoc::RunGenerator(
+      argc, argv, {.default_size = 150, .size_unit = "instructions"},
+      Generate);
+}
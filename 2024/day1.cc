@@ -99,45 +99,65 @@ similarity score at the end of this process is 31 (9 + 4 + 0 + 0 + 9 + 9).
 
 Once again consider your left and right lists. What is their similarity score?
 */
-#include <regex>
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <optional>
+#include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
-#include "utils/utils.h"
+#include "absl/log/check.h"
+#include "utils/day.h"
+#include "utils/extract_ints.h"
+#include "utils/line_stream.h"
 
-std::pair<int, int> ParseLine(const std::string& line) {
-  static const std::regex pattern(R"((\d+)\s+(\d+))");
-  std::smatch match;
+namespace {
 
-  if (std::regex_match(line, match, pattern)) {
-    int first = std::stoi(match[1].str());
-    int second = std::stoi(match[2].str());
-    return std::pair(first, second);
-  } else {
-    exit(1);
-  }
+std::pair<int, int> ParseLine(std::string_view line) {
+  std::array<int64_t, 2> values;
+  CHECK_EQ(aoc::ExtractInts(line, values), values.size())
+      << "Bad line: " << line;
+  return std::pair<int, int>(values[0], values[1]);
 }
 
-int main() {
-  std::vector<std::string> lines =
-      aoc::LoadStringsFromFileByLine("./2024/day1.txt");
-  std::vector<int> l1, l2;
-  for (const auto& line : lines) {
-    std::pair<int, int> entries = ParseLine(line);
-    l1.push_back(entries.first);
-    l2.push_back(entries.second);
+// The two location lists, each sorted.
+struct Lists {
+  std::vector<int> l1;
+  std::vector<int> l2;
+};
+
+// Refills `lists` in place, so a Day reused across inputs keeps the vectors.
+void Parse(std::string_view input, Lists& lists) {
+  lists.l1.clear();
+  lists.l2.clear();
+  aoc::LineStream lines(input);
+  while (std::optional<std::string_view> line = lines.Next()) {
+    std::pair<int, int> entries = ParseLine(*line);
+    lists.l1.push_back(entries.first);
+    lists.l2.push_back(entries.second);
   }
 
-  std::sort(l1.begin(), l1.end());
-  std::sort(l2.begin(), l2.end());
+  std::sort(lists.l1.begin(), lists.l1.end());
+  std::sort(lists.l2.begin(), lists.l2.end());
+}
 
+int Part1(const Lists& lists) {
+  const std::vector<int>& l1 = lists.l1;
+  const std::vector<int>& l2 = lists.l2;
   int sum = 0;
   for (int i = 0; i < l1.size(); i++) {
     sum += std::abs(l1[i] - l2[i]);
   }
-  std::cout << "DIFF PART 1: " << sum << std::endl;
+  return sum;
+}
 
+int Part2(const Lists& lists) {
+  const std::vector<int>& l1 = lists.l1;
+  const std::vector<int>& l2 = lists.l2;
   std::unordered_map<int, int> dict;
-  sum = 0;
+  int sum = 0;
   for (int i = 0; i < l1.size(); i++) {
     if (dict.find(l1[i]) == dict.end()) {
       int count = 0;
@@ -153,7 +173,10 @@ int main() {
       sum += dict[l1[i]];
     }
   }
-  std::cout << "DIFF PART 2: " << sum << std::endl;
-
-  return 0;
+  return sum;
 }
+
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2024, .day = 1, .input_file = "./2024/day1.txt"},
+                 Parse, Part1, Part2);
@@ -151,90 +151,97 @@ of toothpicks and bits of paper and is using them to mark trailheads on your
 topographic map. What is the sum of the ratings of all trailheads?
 
  */
+#include <algorithm>
+#include <cstdint>
 #include <cstdlib>
-#include <print>
+#include <string_view>
 
-#include "absl/container/flat_hash_map.h"
-#include "absl/container/flat_hash_set.h"
 #include "absl/log/check.h"
+#include "utils/day.h"
+#include "utils/grid_search.h"
+#include "utils/thread_pool.h"
 #include "utils/utils.h"
 
+namespace {
+
 using ::aoc::Coordinate;
-using Trail = std::pair<Coordinate, Coordinate>;
-
-class Map {
- public:
-  static constexpr char kEmpty = '.';
-  static constexpr char kAntinode = '#';
-  explicit Map(std::vector<std::string> map) : map_(std::move(map)) {}
-
-  void Print() {
-    std::print("\n");
-    for (std::string_view row : map_) {
-      std::print("{}\n", row);
-    }
-    std::print("\n");
-  }
-
-  bool IsOutOfBounds(Coordinate c) const {
-    bool in_bounds =
-        c.row >= 0 && c.row < NumRows() && c.col >= 0 && c.col < NumCols();
-
-    return !in_bounds;
-  }
-
-  char GetChar(Coordinate c) const { return map_[c.row][c.col]; }
-  int GetInt(Coordinate c) const { return ::aoc::ConvertCharToInt(GetChar(c)); }
-  bool IsEmpty(Coordinate c) const {
-    return GetChar(c) == kEmpty || GetChar(c) == kAntinode;
-  }
-  int NumRows() const { return map_.size(); }
-  int NumCols() const { return map_.front().size(); }
-
- private:
-  std::vector<std::string> map_;
-};
-
-// Returns the number of trailheads
-int NumTrails(const Map& map, absl::flat_hash_set<Trail>& trails,
-              Coordinate start, Coordinate c, int height = 0) {
-  static constexpr int kMaxHeight = 9;
-  if (map.IsOutOfBounds(c)) {
-    // std::print("OOB\n");
-    return 0;  // OOB
-  }
-  if (map.GetInt(c) != height) {
-    // std::print("Invalid height...\n");
-    return 0;  // Not valid height.
-  }
-  // std::print("Checking coordinate {} height {}\n", c.ToString(), height);
-  if (height == kMaxHeight) {
-    // std::print("Summit Reached!\n");
-    trails.insert({start, c});
-    return 1;  // Base case - we reached summit.
-  }
-  // Otherwise, recurse in all directions with the next height.
-  ++height;
-  return NumTrails(map, trails, start, GoRight(c), height) +
-         NumTrails(map, trails, start, GoLeft(c), height) +
-         NumTrails(map, trails, start, GoDown(c), height) +
-         NumTrails(map, trails, start, GoUp(c), height);
+using ::aoc::Map;
+
+static constexpr int kMaxHeight = 9;
+
+// Rows scored by one task, which builds a single GridSearch for all of them.
+static constexpr int64_t kRowsPerTask = 8;
+
+// Trails only ever climb by exactly one.
+bool CanStep(const Map& map, Coordinate from, Coordinate to) {
+  return map.GetInt(to) == map.GetInt(from) + 1;
 }
-int main() {
-  Map map(aoc::LoadStringsFromFileByLine("./2024/day10.txt"));
-  int num_paths = 0;
-  // Trails are a start and end position that are connected.
-  absl::flat_hash_set<Trail> trails;
-  for (int row = 0; row < map.NumRows(); ++row) {
-    for (int col = 0; col < map.NumCols(); ++col) {
-      Coordinate position{row, col};
-      num_paths += NumTrails(map, trails, position, position);
-    }
-  }
-
-  // This info isn't even needed.
-  std::print("Number of trails: {}\n", trails.size());
-  std::print("Number of paths: {}\n", num_paths);
-
-  return 0;
+
+// The number of distinct summits reachable from `start`, reusing `search`'s
+// buffers.
+int64_t TrailheadScore(const Map& map, aoc::GridSearch<>& search,
+                       Coordinate start) {
+  int64_t trails = 0;
+  // Every step climbs one, so the BFS depth from a height 0 start is the
+  // height.
+  search.Bfs(
+      start,
+      [&map](Coordinate from, Coordinate to) { return CanStep(map, from, to); },
+      [&](Coordinate c, int64_t depth) {
+        if (depth == kMaxHeight) ++trails;
+      });
+  return trails;
+}
+
+// The number of distinct hiking paths from `start` to any summit.
+int64_t TrailheadRating(const Map& map, aoc::GridSearch<>& search,
+                        Coordinate start) {
+  int64_t paths = 0;
+  // Heights strictly increase, so there are no cycles to worry about.
+  search.ForEachPath(
+      start,
+      [&map](Coordinate from, Coordinate to) { return CanStep(map, from, to); },
+      [&](Coordinate c) {
+        if (map.GetInt(c) == kMaxHeight) ++paths;
+      });
+  return paths;
 }
+
+// Sums score(map, search, trailhead) over every trailhead. Trailheads are
+// scored independently, kRowsPerTask rows per task, and each task reuses one
+// GridSearch for all of its trailheads.
+template <typename Score>
+int64_t SumOverTrailheads(const Map& map, Score score) {
+  const int64_t num_tasks = (map.NumRows() + kRowsPerTask - 1) / kRowsPerTask;
+  return aoc::ParallelReduce(
+      0, num_tasks, int64_t{0},
+      [&map, &score](int64_t task) {
+        aoc::GridSearch search(map.NumRows(), map.NumCols());
+        const int64_t end =
+            std::min<int64_t>(map.NumRows(), (task + 1) * kRowsPerTask);
+        int64_t sum = 0;
+        for (int64_t row = task * kRowsPerTask; row < end; ++row) {
+          for (int col = 0; col < map.NumCols(); ++col) {
+            Coordinate start{static_cast<int>(row), col};
+            if (map.GetInt(start) == 0) {
+              sum += score(map, search, start);
+            }
+          }
+        }
+        return sum;
+      },
+      [](int64_t a, int64_t b) { return a + b; });
+}
+
+Map Parse(std::string_view input) { return Map(aoc::SplitLines(input)); }
+
+int64_t Part1(const Map& map) { return SumOverTrailheads(map, TrailheadScore); }
+
+int64_t Part2(const Map& map) {
+  return SumOverTrailheads(map, TrailheadRating);
+}
+
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2024, .day = 10, .input_file = "./2024/day10.txt"},
+                 Parse, Part1, Part2);
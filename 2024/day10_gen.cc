@@ -0,0 +1,27 @@
+// Generates 2024 day 10 inputs: a --size by --size topographic map. Heights
+// mostly climb diagonally, (row + col) % 10, so that there are plenty of
+// trails, with 10% of the cells random.
+
+#include <cstdint>
+
+#include "utils/gen.h"
+
+namespace {
+
+void Generate(aoc::Generator& gen) {
+  for (int64_t row = 0; row < gen.size(); ++row) {
+    for (int64_t col = 0; col < gen.size(); ++col) {
+      int64_t height = gen.Chance(0.1) ? gen.Uniform(0, 9) : (row + col) % 10;
+      gen.Write(static_cast<char>('0' + height));
+    }
+    gen.Write('\n');
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  return aoc::RunGenerator(
+      argc, argv, {.default_size = 57, .size_unit = "rows and columns"},
+      Generate);
+}
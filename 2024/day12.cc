@@ -110,14 +110,22 @@ So, it has a total price of 1930.
 
 What is the total price of fencing all regions on your map?
  */
+#include <array>
+#include <cassert>
 #include <cstdlib>
-#include <print>
+#include <optional>
+#include <string_view>
 
 #include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
 #include "absl/log/check.h"
+#include "utils/day.h"
+#include "utils/embedded_input.h"
+#include "utils/grid_search.h"
 #include "utils/utils.h"
 
+namespace {
+
 using ::aoc::Coordinate;
 using ::aoc::Direction;
 using ::aoc::GoDown;
@@ -193,43 +201,45 @@ int64_t CountCorners(const Map& map, VisitedMap& visited, Coordinate c) {
   count +=
       CountCorner(map, visited, character, GoLeft(c), GoUp(c), GoLeft(GoUp(c)));
 
-  std::print("Counted {} corners at coordinate {}.\n", count, c.ToString());
+  AOC_LOG(TRACE, "Counted {} corners at coordinate {}.", count, c.ToString());
 
   return count;
 }
 
-void ComputeRegion(const Map& map, VisitedMap& visited, Region& region,
-                   char region_char, Coordinate current) {
-  // OOB - this is a perimeter edge.
-  if (map.IsOutOfBounds(current)) {
-    region.perimeter++;
-    return;
-  }
-  // Wrong char. This is a perimeter edge.
-  if (map.GetChar(current) != region_char) {
-    region.perimeter++;
-    return;
-  }
-  // visited. Do nothing.
-  if (visited.IsVisited(current)) {
-    return;
+// The order the flood fill explores neighbors in. CountCorners() looks at
+// which neighbors are already visited, so this order is load-bearing.
+struct FloodFillOrder {
+  std::array<Coordinate, 4> operator()(Coordinate c) const {
+    return {GoUp(c), GoRight(c), GoLeft(c), GoDown(c)};
   }
-  // Otherwise, this is a part of the region.
-  // Mark it as visited and include it in the area, and recurse.
-  region.area++;
-  visited.MarkVisited(current);
-
-  region.sides += CountCorners(map, visited, current);
-
-  // std::print("Counted {} corners so far at {}\n", region.sides,
-  //            current.ToString());
-
-  ComputeRegion(map, visited, region, region_char, GoUp(current));
-  ComputeRegion(map, visited, region, region_char, GoRight(current));
-  ComputeRegion(map, visited, region, region_char, GoLeft(current));
-  ComputeRegion(map, visited, region, region_char, GoDown(current));
-
-  return;
+};
+using RegionSearch = aoc::GridSearch<FloodFillOrder>;
+
+void ComputeRegion(const Map& map, VisitedMap& visited, RegionSearch& search,
+                   Region& region, char region_char, Coordinate start) {
+  search.Dfs(
+      start,
+      [&](Coordinate from, Coordinate to) {
+        return map.GetChar(to) == region_char;
+      },
+      [&](Coordinate current) {
+        // This is a part of the region. Mark it as visited and include it in
+        // the area.
+        region.area++;
+        visited.MarkVisited(current);
+
+        // Every neighbor that is OOB or a different char is a perimeter edge.
+        for (Coordinate next : FloodFillOrder()(current)) {
+          if (!map.CharEquals(next, region_char)) {
+            region.perimeter++;
+          }
+        }
+
+        region.sides += CountCorners(map, visited, current);
+
+        // std::print("Counted {} corners so far at {}\n", region.sides,
+        //            current.ToString());
+      });
 }
 
 struct Price {
@@ -248,7 +258,8 @@ struct Price {
   }
 };
 
-Price RegionPrice(const Map& map, VisitedMap& visited, Coordinate start) {
+Price RegionPrice(const Map& map, VisitedMap& visited, RegionSearch& search,
+                  Coordinate start) {
   // If visited, return 0.
   if (visited.IsVisited(start)) {
     return {};
@@ -258,33 +269,51 @@ Price RegionPrice(const Map& map, VisitedMap& visited, Coordinate start) {
   char region_char = map.GetChar(start);
   Region region;
 
-  ComputeRegion(map, visited, region, region_char, start);
+  ComputeRegion(map, visited, search, region, region_char, start);
 
-  std::print("Region {} starting at {} is {} area, {} perimeter, {} sides.\n",
-             region_char, start.ToString(), region.area, region.perimeter,
-             region.sides);
+  AOC_LOG(DEBUG, "Region {} starting at {} is {} area, {} perimeter, {} sides.",
+          region_char, start.ToString(), region.area, region.perimeter,
+          region.sides);
 
   return {.price = region.area * region.perimeter,
           .bulk = region.area * region.sides};
 }
 
-int main() {
-  // Map map(aoc::LoadStringsFromFileByLine("./2024/day12example.txt"));
-  Map map(aoc::LoadStringsFromFileByLine("./2024/day12.txt"));
-
+// The fence price of every region, both by perimeter and by side.
+Price TotalPrice(const Map& map) {
   VisitedMap visited(map.NumRows(), map.NumCols());
+  RegionSearch search(map.NumRows(), map.NumCols());
 
   Price price{};
-  // Trails are a start and end position that are connected.
   for (int row = 0; row < map.NumRows(); ++row) {
     for (int col = 0; col < map.NumCols(); ++col) {
       Coordinate position{row, col};
-      price += RegionPrice(map, visited, position);
+      price += RegionPrice(map, visited, search, position);
     }
   }
+  return price;
+}
 
-  // This info isn't even needed.
-  std::print("Price: {}\nBulk Price: {}\n", price.price, price.bulk);
-
-  return 0;
+void Examples() {
+  std::optional<std::string_view> input =
+      aoc::FindEmbeddedInput("2024/day12example.txt");
+  CHECK(input.has_value()) << "2024/day12example.txt is not embedded";
+  Map map(aoc::SplitLines(*input));
+  Price price = TotalPrice(map);
+  assert(price.price == 1184);
+  assert(price.bulk == 368);
 }
+
+Map Parse(std::string_view input) { return Map(aoc::SplitLines(input)); }
+
+int64_t Part1(const Map& map) { return TotalPrice(map).price; }
+
+int64_t Part2(const Map& map) { return TotalPrice(map).bulk; }
+
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2024,
+                  .day = 12,
+                  .input_file = "./2024/day12.txt",
+                  .examples = Examples},
+                 Parse, Part1, Part2);
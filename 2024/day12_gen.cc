@@ -0,0 +1,41 @@
+// Generates 2024 day 12 inputs: a --size by --size garden of irregular plots.
+// Each cell usually copies the plant above or to its left, and otherwise
+// starts something new.
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "utils/gen.h"
+
+namespace {
+
+void Generate(aoc::Generator& gen) {
+  constexpr char kPlants[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+  const int64_t n = gen.size();
+  std::string above(n, ' ');
+  std::string row(n, ' ');
+  for (int64_t r = 0; r < n; ++r) {
+    for (int64_t c = 0; c < n; ++c) {
+      const int64_t roll = gen.Uniform(0, 99);
+      if (r > 0 && roll < 45) {
+        row[c] = above[c];
+      } else if (c > 0 && roll < 90) {
+        row[c] = row[c - 1];
+      } else {
+        row[c] = gen.Pick(kPlants);
+      }
+    }
+    gen.Write(row);
+    gen.Write('\n');
+    std::swap(above, row);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  return aoc::RunGenerator(
+      argc, argv, {.default_size = 140, .size_unit = "rows and columns"},
+      Generate);
+}
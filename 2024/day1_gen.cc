@@ -0,0 +1,21 @@
+// Generates 2024 day 1 inputs: --size pairs of five-digit location IDs.
+
+#include <cstdint>
+
+#include "utils/gen.h"
+
+namespace {
+
+void Generate(aoc::Generator& gen) {
+  for (int64_t i = 0; i < gen.size(); ++i) {
+    gen.Print("{}   {}\n", gen.Uniform(10000, 99999),
+              gen.Uniform(10000, 99999));
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  return aoc::RunGenerator(
+      argc, argv, {.default_size = 1000, .size_unit = "lines"}, Generate);
+}
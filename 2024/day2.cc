@@ -71,11 +71,20 @@ Update your analysis by handling situations where the Problem Dampener can
 remove a single level from unsafe reports. How many reports are now safe?
 */
 
+#include <cstdint>
 #include <cstdlib>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "absl/log/check.h"
+#include "utils/day.h"
+#include "utils/line_stream.h"
 #include "utils/utils.h"
 
+namespace {
+
 bool IsSafe(const std::vector<int64_t>& report) {
   bool should_increase = report[0] < report[1];
   bool should_decrease = !should_increase;
@@ -116,42 +125,46 @@ std::vector<int64_t> RemoveIndex(const std::vector<int64_t>& input,
   return result;
 }
 
-int main() {
-  std::vector<std::string> lines =
-      aoc::LoadStringsFromFileByLine("2024/day2.txt");
+bool IsSafeWithDampener(const std::vector<int64_t>& report) {
+  if (IsSafe(report)) {
+    return true;
+  }
+  // Try finding a permutation that is safe.
+  for (int i = 0; i < report.size(); ++i) {
+    if (IsSafe(RemoveIndex(report, i))) {
+      return true;
+    }
+  }
+  return false;
+}
 
-  std::vector<std::vector<int64_t>> reports;
-  for (const auto& line : lines) {
-    std::vector<int64_t> values;
-    std::vector<std::string> number_str = aoc::SplitDelimitedString(line);
-    for (const auto& number : aoc::SplitDelimitedString(line)) {
+// Safe reports, without and with the Problem Dampener.
+struct Counts {
+  int64_t safe = 0;
+  int64_t safe_with_dampener = 0;
+};
+
+Counts Parse(aoc::LineStream& lines) {
+  Counts counts;
+  std::vector<int64_t> report;
+  while (std::optional<std::string_view> line = lines.Next()) {
+    report.clear();
+    for (std::string_view number : aoc::Split(*line)) {
       absl::StatusOr<int64_t> value = aoc::ConvertStringViewToInt64(number);
       CHECK_OK(value);
-      values.push_back(*value);
+      report.push_back(*value);
     }
-    reports.push_back(std::move(values));
+    counts.safe += IsSafe(report);
+    counts.safe_with_dampener += IsSafeWithDampener(report);
   }
+  return counts;
+}
 
-  int num_safe_reports = 0;
-  int num_safe_reports_part_2 = 0;
-  for (const auto& report : reports) {
-    if (IsSafe(report)) {
-      ++num_safe_reports;
-      ++num_safe_reports_part_2;
-    } else {
-      // Try finding a permutation that is safe.
-      for (int i = 0; i < report.size(); ++i) {
-        if (IsSafe(RemoveIndex(report, i))) {
-          ++num_safe_reports_part_2;
-          break;
-        }
-      }
-    }
-  }
+int64_t Part1(const Counts& counts) { return counts.safe; }
 
-  // std::print("Number of safe reports: {}\n", num_safe_reports);
-  // std::print("Number of safe reports (part 2): {}\n",
-  // num_safe_reports_part_2);
+int64_t Part2(const Counts& counts) { return counts.safe_with_dampener; }
 
-  return 0;
-}
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2024, .day = 2, .input_file = "./2024/day2.txt"},
+                 Parse, Part1, Part2);
@@ -0,0 +1,33 @@
+// Generates 2024 day 2 inputs: --size reports of 5 to 8 levels. Most reports
+// step steadily up or down; some have one bad step, and a few have several.
+
+#include <cstdint>
+
+#include "utils/gen.h"
+
+namespace {
+
+void Generate(aoc::Generator& gen) {
+  for (int64_t i = 0; i < gen.size(); ++i) {
+    const int64_t length = gen.Uniform(5, 8);
+    const int64_t direction = gen.Chance(0.5) ? 1 : -1;
+    const double bad_step_chance = gen.Chance(0.5) ? 0.0 : 0.15;
+    int64_t level = gen.Uniform(10, 89);
+    gen.Print("{}", level);
+    for (int64_t j = 1; j < length; ++j) {
+      int64_t step = gen.Chance(bad_step_chance)
+                         ? gen.Uniform(-3, 6)
+                         : direction * gen.Uniform(1, 3);
+      level += step;
+      gen.Print(" {}", level);
+    }
+    gen.Write('\n');
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  return aoc::RunGenerator(
+      argc, argv, {.default_size = 1000, .size_unit = "reports"}, Generate);
+}
@@ -1,9 +1,12 @@
 #include <cassert>
 #include <cctype>
+#include <string_view>
 
-#include "utils/utils.h"
+#include "utils/day.h"
 
-void CheckForMulFunc(const std::string &input, int &sum, int &i) {
+namespace {
+
+void CheckForMulFunc(std::string_view input, int &sum, int &i) {
   // std::cout << input.substr(i, 4) << std::endl;
   if (input.substr(i, 4) != "mul(") {
     // std::cout << input.substr(i, 4) << std::endl;
@@ -15,7 +18,7 @@ void CheckForMulFunc(const std::string &input, int &sum, int &i) {
   int num2 = 0;
   int digit_count = 0;
   int digit;
-  for (int j = i; j < i + 4; j++) {
+  for (int j = i; j < i + 4 && j < input.size(); j++) {
     digit_count++;
     if (std::isdigit(input[j])) {
       digit = input[j] - '0';
@@ -33,7 +36,7 @@ void CheckForMulFunc(const std::string &input, int &sum, int &i) {
     return;
   }
 
-  for (int j = i; j < i + 4; j++) {
+  for (int j = i; j < i + 4 && j < input.size(); j++) {
     if (std::isdigit(input[j])) {
       digit = input[j] - '0';
       num2 *= 10;
@@ -52,7 +55,7 @@ void CheckForMulFunc(const std::string &input, int &sum, int &i) {
   sum += num1 * num2;
 }
 
-void CheckForSwitch(std::string input, bool &enabled, int &i) {
+void CheckForSwitch(std::string_view input, bool &enabled, int &i) {
   if (input.substr(i, 7) == "don't()") {
     enabled = false;
     i += 6;
@@ -63,7 +66,7 @@ void CheckForSwitch(std::string input, bool &enabled, int &i) {
   return;
 }
 
-int CalculateSumP2(const std::string &input) {
+int CalculateSumP2(std::string_view input) {
   bool enabled = true;
   int sum = 0;
   for (int i = 0; i < input.size(); i++) {
@@ -77,7 +80,7 @@ int CalculateSumP2(const std::string &input) {
   return sum;
 }
 
-int CalculateSum(const std::string &input) {
+int CalculateSum(std::string_view input) {
   int sum = 0;
   for (int i = 0; i < input.size(); i++) {
     if (input[i] == 'm') {
@@ -88,13 +91,22 @@ int CalculateSum(const std::string &input) {
   return sum;
 }
 
-int main() {
-  std::string input = aoc::ReadFileToString("./2024/day3.txt");
-  // std::string input =
-  //     "xmul(2,4)%&mul[3,7]!@^do_not_mul(5,5)+mul(32,64]then(mul(11,8)mul(8,5))";
-  //  std::cout << "SUM: " << CalculateSum(input) << std::endl;
-  //  assert(CalculateSum(input) == 161);
-  std::cout << "Part 1: " << CalculateSum(input) << std::endl;
-  std::cout << "Part 2: " << CalculateSumP2(input);
-  return 0;
-}
\ No newline at end of file
+void Examples() {
+  assert(CalculateSum("xmul(2,4)%&mul[3,7]!@^do_not_mul(5,5)+mul(32,64]then("
+                      "mul(11,8)mul(8,5))") == 161);
+}
+
+// The program is scanned in place, so there is nothing to parse.
+std::string_view Parse(std::string_view input) { return input; }
+
+int Part1(std::string_view input) { return CalculateSum(input); }
+
+int Part2(std::string_view input) { return CalculateSumP2(input); }
+
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2024,
+                  .day = 3,
+                  .input_file = "./2024/day3.txt",
+                  .examples = Examples},
+                 Parse, Part1, Part2);
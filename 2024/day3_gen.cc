@@ -0,0 +1,57 @@
+// Generates 2024 day 3 inputs: about --size characters of corrupted memory,
+// with mul(X,Y), do() and don't() instructions, some of them mangled, among
+// the noise.
+
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <string_view>
+
+#include "utils/gen.h"
+
+namespace {
+
+void Generate(aoc::Generator& gen) {
+  constexpr std::string_view kNoise = "!@#$%^&*()[]{}<>,;:'~+-/ whyow";
+  constexpr std::string_view kDecoys[] = {
+      "mul(",   "mul[3,4]", "mul ( 2 , 4 )", "don't", "do(",
+      "mul(4*", "from()",   "what()",        "mul(5,5",
+  };
+  // Real inputs are a few lines of a few thousand characters.
+  constexpr int64_t kLineLength = 4000;
+  int64_t written = 0;
+  int64_t line_length = 0;
+  auto emit = [&](std::string_view text) {
+    gen.Write(text);
+    written += text.size();
+    line_length += text.size();
+  };
+  while (written < gen.size()) {
+    const int64_t roll = gen.Uniform(0, 99);
+    if (roll < 8) {
+      emit(std::format("mul({},{})", gen.Uniform(1, 999), gen.Uniform(1, 999)));
+    } else if (roll < 9) {
+      emit("do()");
+    } else if (roll < 10) {
+      emit("don't()");
+    } else if (roll < 14) {
+      emit(kDecoys[gen.Uniform(0, std::size(kDecoys) - 1)]);
+    } else {
+      char noise = gen.Pick(kNoise);
+      emit(std::string_view(&noise, 1));
+    }
+    if (line_length >= kLineLength) {
+      emit("\n");
+      line_length = 0;
+    }
+  }
+  gen.Write('\n');
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  return aoc::RunGenerator(
+      argc, argv, {.default_size = 20000, .size_unit = "characters"},
+      Generate);
+}
@@ -79,12 +79,19 @@ Flip the word search from the instructions back over to the word search side and
 try again. How many times does an X-MAS appear?
 
 */
+#include <cstdint>
 #include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "absl/log/check.h"
-#include <print>
+#include "utils/day.h"
+#include "utils/thread_pool.h"
 #include "utils/utils.h"
 
+namespace {
+
 struct Coordinate {
   int x = 0;
   int y = 0;
@@ -180,18 +187,35 @@ bool CountMasInAnXShape(const std::vector<std::string>& grid,
   return true;
 }
 
-int main() {
-  std::vector<std::string> grid =
-      aoc::LoadStringsFromFileByLine("./2024/day4.txt");
+using WordSearch = std::vector<std::string>;
+
+WordSearch Parse(std::string_view input) { return aoc::SplitLines(input); }
+
+// Sums count(grid, {x, y}) over every cell. Every cell is checked
+// independently, so whole rows are handed to the pool.
+template <typename Count>
+int32_t CountAll(const WordSearch& grid, Count count) {
+  return aoc::ParallelReduce(
+      0, grid.size(), int32_t{0},
+      [&grid, &count](int64_t y) {
+        int32_t row = 0;
+        for (int x{0}; x < grid.front().size(); ++x) {
+          row += count(grid, Coordinate{x, static_cast<int>(y)});
+        }
+        return row;
+      },
+      [](int32_t a, int32_t b) { return a + b; });
+}
 
-  int32_t total{0};
-  int32_t total_part2{0};
-  for (int y{0}; y < grid.size(); ++y) {
-    for (int x{0}; x < grid.front().size(); ++x) {
-      total += CountXmasFromX(grid, {x, y});
-      total_part2 += CountMasInAnXShape(grid, {x, y});
-    }
-  }
-  std::print("The total is: {}\n", total);
-  std::print("The part 2 total is: {}\n", total_part2);
+int32_t Part1(const WordSearch& grid) {
+  return CountAll(grid, CountXmasFromX);
 }
+
+int32_t Part2(const WordSearch& grid) {
+  return CountAll(grid, CountMasInAnXShape);
+}
+
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2024, .day = 4, .input_file = "./2024/day4.txt"},
+                 Parse, Part1, Part2);
@@ -0,0 +1,25 @@
+// Generates 2024 day 4 inputs: a --size by --size word search of X, M, A and
+// S.
+
+#include <cstdint>
+
+#include "utils/gen.h"
+
+namespace {
+
+void Generate(aoc::Generator& gen) {
+  for (int64_t row = 0; row < gen.size(); ++row) {
+    for (int64_t col = 0; col < gen.size(); ++col) {
+      gen.Write(gen.Pick("XMAS"));
+    }
+    gen.Write('\n');
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  return aoc::RunGenerator(
+      argc, argv, {.default_size = 140, .size_unit = "rows and columns"},
+      Generate);
+}
@@ -215,26 +215,79 @@ You need to get the guard stuck in a loop by adding a single new obstruction.
 How many different positions could you choose for this obstruction?
 
 */
+#include <array>
 #include <cstdlib>
 #include <print>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
 #include "absl/log/check.h"
+#include "utils/day.h"
 #include "utils/utils.h"
 
+namespace {
+
 using ::aoc::Coordinate;
 
+// The set of (position, heading) pairs the guard has been in during a single
+// simulation. Backed by one epoch-stamped map per heading, so starting the next
+// simulation is O(1) and nothing is allocated per candidate obstacle.
+class GuardPath {
+ public:
+  GuardPath(int rows, int cols)
+      : headings_{aoc::EpochVisitedMap(rows, cols),
+                  aoc::EpochVisitedMap(rows, cols),
+                  aoc::EpochVisitedMap(rows, cols),
+                  aoc::EpochVisitedMap(rows, cols)} {}
+
+  void Reset() {
+    for (auto& heading : headings_) {
+      heading.Reset();
+    }
+  }
+
+  bool Contains(Coordinate c, char guard_char) const {
+    return headings_[HeadingIndex(guard_char)].IsVisited(c);
+  }
+
+  void Insert(Coordinate c, char guard_char) {
+    headings_[HeadingIndex(guard_char)].MarkVisited(c);
+  }
+
+ private:
+  static int HeadingIndex(char guard_char) {
+    switch (guard_char) {
+      case '^':
+        return 0;
+      case '>':
+        return 1;
+      case 'v':
+        return 2;
+      default:
+        return 3;
+    }
+  }
+
+  std::array<aoc::EpochVisitedMap, 4> headings_;
+};
+
 class Map {
  public:
   static constexpr char kVisited = 'X';
   static constexpr char kOutOfBounds = 'O';
   static constexpr char kObstacle = '#';
   static constexpr char kEmpty = '.';
-  explicit Map(std::vector<std::string> map) : map_(std::move(map)) {
-    for (int row = 0; row < map_.size(); ++row) {
-      auto col = map_[row].find_first_of("^>v<");
-      if (col != std::string::npos) {
+  explicit Map(const std::vector<std::string>& map)
+      : map_(aoc::Grid<char>::FromLines(map)) {
+    for (int row = 0; row < map_.NumRows(); ++row) {
+      std::span<const char> cells = map_.Row(row);
+      auto col = std::string_view(cells.data(), cells.size())
+                     .find_first_of("^>v<");
+      if (col != std::string_view::npos) {
         // We found the guard! Mark his position.
         guard_ = {row, static_cast<int>(col)};
 
@@ -253,14 +306,15 @@ class Map {
   // Does not modify the map, but tries to place an obstacle in front of the
   // guard at the current location and determines if the guard would become
   // stuck in a loop if an obstacle was added there. Returns true if so, or
-  // false if not.
-  bool NextObstacleCreatesLoop() {
+  // false if not. `path` is scratch space for loop detection and is reset on
+  // every call.
+  bool NextObstacleCreatesLoop(GuardPath& path) {
     if (!HasGuard()) return false;
     Coordinate candidate = NextCoordinate();
 
     if (candidate == guard_starting_position_) {
       // An obstacle is not allowed here.
-      std::print("No obstacle allowed here!==-----------------------------\n");
+      AOC_LOG(DEBUG, "No obstacle allowed here!");
       return false;
     }
 
@@ -291,7 +345,7 @@ class Map {
     }
 
     // Create a copy of the map up to this point.
-    Map test_map{map_};
+    Map test_map = *this;
 
     // Make the next spot an obstacle in the map.
     test_map.SetChar(candidate, kObstacle);
@@ -303,8 +357,7 @@ class Map {
     //     test_map.GetGuardChar(), test_map.CurrentPosition().row,
     //     test_map.CurrentPosition().col, candidate.row, candidate.col);
 
-    using CoordinateAndGuardChar = std::pair<Coordinate, char>;
-    absl::flat_hash_set<CoordinateAndGuardChar> potential_loop_path{};
+    path.Reset();
     while (true) {
       test_map.Tick();
       if (!test_map.HasGuard()) {
@@ -315,12 +368,11 @@ class Map {
       Coordinate next_coordinate = test_map.NextCoordinate();
 
       // This is where we are now and the direction we're facing.
-      CoordinateAndGuardChar coordinate_and_guard_char = {
-          next_coordinate, test_map.GetGuardChar()};
-      // std::print("Next: {} at {}, {}\n", coordinate_and_guard_char.second,
+      char guard_char = test_map.GetGuardChar();
+      // std::print("Next: {} at {}, {}\n", guard_char,
       //            next_coordinate.row, next_coordinate.col);
       // We haven't seen this exact position and direction yet.
-      if (potential_loop_path.contains(coordinate_and_guard_char)) {
+      if (path.Contains(next_coordinate, guard_char)) {
         // if (test_map.NextCoordinate() == candidate &&
         //    test_map.GetGuardChar() == GetGuardChar()) {
         //   We returned to this obstacle while going the same direction as
@@ -330,14 +382,14 @@ class Map {
         //            loop_creating_obstacles_.size());
 
         // Print it out so we can confirm it works.
-        std::print("Found Loop Obstacle!\n");
+        AOC_LOG(DEBUG, "Found Loop Obstacle!");
         // test_map.SetChar(candidate, 'O');
         // test_map.Print();
         // std::print("\n\n");
         return true;
       }
       // Add this position and direction to the set.
-      potential_loop_path.insert(coordinate_and_guard_char);
+      path.Insert(next_coordinate, guard_char);
     }
     // Unreachable.
     return false;
@@ -380,20 +432,18 @@ class Map {
     }
   }
 
-  int CountVisited() {
-    int visited = 0;
-    for (std::string_view row : map_) {
-      visited += std::count(row.begin(), row.end(), kVisited);
-    }
-    return visited;
-  }
+  int CountVisited() { return map_.Count(kVisited); }
 
   void Print() {
-    for (std::string_view row : map_) {
-      std::print("{}\n", row);
+    for (int row = 0; row < map_.NumRows(); ++row) {
+      std::span<const char> cells = map_.Row(row);
+      std::print("{}\n", std::string_view(cells.data(), cells.size()));
     }
   }
 
+  int NumRows() const { return map_.NumRows(); }
+  int NumCols() const { return map_.NumCols(); }
+
   Coordinate CurrentPosition() const { return *guard_; }
   Coordinate NextCoordinate() const {
     Coordinate next = *guard_;
@@ -424,35 +474,46 @@ class Map {
     }
   }
 
-  bool OutOfBounds(Coordinate c) const {
-    bool in_bounds = c.row >= 0 && c.row < map_.size() && c.col >= 0 &&
-                     c.col < map_.front().size();
-    return !in_bounds;
-  }
-  void SetChar(Coordinate c, char val) { map_[c.row][c.col] = val; }
-  char GetChar(Coordinate c) const { return map_[c.row][c.col]; }
+  bool OutOfBounds(Coordinate c) const { return map_.IsOutOfBounds(c); }
+  void SetChar(Coordinate c, char val) { map_[c] = val; }
+  char GetChar(Coordinate c) const { return map_[c]; }
   Coordinate guard_starting_position_;
-  std::vector<std::string> map_;
+  aoc::Grid<char> map_;
   std::optional<Coordinate> guard_;
   // absl::flat_hash_set<Coordinate> loop_creating_obstacles_;
 };
 
-int main() {
-  Map map(aoc::LoadStringsFromFileByLine("./2024/day6.txt"));
+Map Parse(std::string_view input) { return Map(aoc::SplitLines(input)); }
 
+int Part1(const Map& start) {
+  Map map = start;
+  while (map.HasGuard()) {
+    map.Tick();
+  }
+  if constexpr (AOC_LOG_ENABLED(DEBUG)) {
+    map.Print();
+  }
+  return map.CountVisited();
+}
+
+int Part2(const Map& start) {
+  Map map = start;
   int count_loop_obstacles = 0;
+  GuardPath path(map.NumRows(), map.NumCols());
 
+  int step = 0;
   while (map.HasGuard()) {
-    // std::print("Step!\n");
     map.Tick();
-    static int count = 0;
-    std::print("Step {}================================\n", ++count);
-    if (map.NextObstacleCreatesLoop()) {
+    ++step;
+    AOC_LOG(TRACE, "Step {}", step);
+    if (map.NextObstacleCreatesLoop(path)) {
       ++count_loop_obstacles;
     }
-    // map.Print();
   }
-  map.Print();
-  std::print("Total Visited: {}\n", map.CountVisited());
-  std::print("Loop Obstacles Added: {}\n", count_loop_obstacles);
+  return count_loop_obstacles;
 }
+
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2024, .day = 6, .input_file = "./2024/day6.txt"},
+                 Parse, Part1, Part2);
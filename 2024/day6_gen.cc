@@ -0,0 +1,85 @@
+// Generates 2024 day 6 inputs: a --size by --size lab with the guard facing up
+// somewhere in the middle half.
+//
+// Obstacles thin out as the lab grows (5%, or 8 per row at most) so that the
+// guard's walk grows with it. The puzzle promises that the guard leaves, so
+// the generator walks the guard itself and removes any obstacle that turns
+// it into a loop. The whole lab is held in memory: one byte per cell.
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "utils/gen.h"
+
+namespace {
+
+constexpr uint8_t kObstacle = 1;
+// Bit 1 << (dir + 1) of a cell is set once the guard has left it facing dir.
+constexpr int64_t kRowStep[] = {-1, 0, 1, 0};
+constexpr int64_t kColStep[] = {0, 1, 0, -1};
+
+void Generate(aoc::Generator& gen) {
+  const int64_t n = gen.size();
+  const double density = std::min(0.05, 8.0 / n);
+  std::vector<uint8_t> lab(n * n);
+  for (uint8_t& cell : lab) {
+    cell = gen.Chance(density) ? kObstacle : 0;
+  }
+  const int64_t guard_row = gen.Uniform(n / 4, n - n / 4 - 1);
+  const int64_t guard_col = gen.Uniform(n / 4, n - n / 4 - 1);
+  lab[guard_row * n + guard_col] = 0;
+
+  while (true) {
+    for (uint8_t& cell : lab) {
+      cell &= kObstacle;
+    }
+    int64_t row = guard_row;
+    int64_t col = guard_col;
+    int dir = 0;
+    int64_t last_turn = -1;
+    bool looped = false;
+    while (true) {
+      uint8_t& cell = lab[row * n + col];
+      const uint8_t seen = 2 << dir;
+      if (cell & seen) {
+        looped = true;
+        break;
+      }
+      cell |= seen;
+      const int64_t next_row = row + kRowStep[dir];
+      const int64_t next_col = col + kColStep[dir];
+      if (next_row < 0 || next_row >= n || next_col < 0 || next_col >= n) {
+        break;
+      }
+      if (lab[next_row * n + next_col] & kObstacle) {
+        dir = (dir + 1) % 4;
+        last_turn = next_row * n + next_col;
+        continue;
+      }
+      row = next_row;
+      col = next_col;
+    }
+    if (!looped) break;
+    lab[last_turn] = 0;
+  }
+
+  for (int64_t row = 0; row < n; ++row) {
+    for (int64_t col = 0; col < n; ++col) {
+      if (row == guard_row && col == guard_col) {
+        gen.Write('^');
+      } else {
+        gen.Write(lab[row * n + col] & kObstacle ? '#' : '.');
+      }
+    }
+    gen.Write('\n');
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  return aoc::RunGenerator(
+      argc, argv, {.default_size = 130, .size_unit = "rows and columns"},
+      Generate);
+}
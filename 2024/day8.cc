@@ -148,10 +148,16 @@ locations within the bounds of the map contain an antinode?
  */
 #include <cstdlib>
 #include <print>
+#include <string>
+#include <string_view>
+#include <vector>
 
-#include "absl/container/flat_hash_set.h"
+#include "utils/coord_set.h"
+#include "utils/day.h"
 #include "utils/utils.h"
 
+namespace {
+
 using ::aoc::Coordinate;
 
 class Map {
@@ -160,8 +166,8 @@ class Map {
   static constexpr char kAntinode = '#';
   explicit Map(std::vector<std::string> map) : map_(std::move(map)) {}
 
-  absl::flat_hash_set<Coordinate> ComputeAntinodes(bool with_harmonics) {
-    absl::flat_hash_set<Coordinate> antinodes;
+  aoc::CoordSet ComputeAntinodes(bool with_harmonics) const {
+    aoc::CoordSet antinodes(NumRows(), NumCols());
 
     for (int row = 0; row < NumRows(); ++row) {
       for (int col = 0; col < NumCols(); ++col) {
@@ -170,16 +176,15 @@ class Map {
           continue;
         }
         // We have an antenna.
-        antinodes.merge(ComputeCoordinateAntinodes(position, with_harmonics));
+        AddCoordinateAntinodes(position, with_harmonics, antinodes);
       }
     }
 
     return antinodes;
   }
 
-  absl::flat_hash_set<Coordinate> ComputeCoordinateAntinodes(
-      Coordinate antenna, bool with_harmonics) {
-    absl::flat_hash_set<Coordinate> antinodes;
+  void AddCoordinateAntinodes(Coordinate antenna, bool with_harmonics,
+                              aoc::CoordSet& antinodes) const {
     char antenna_type = GetChar(antenna);
     for (int row = 0; row < NumRows(); ++row) {
       for (int col = 0; col < NumCols(); ++col) {
@@ -195,7 +200,7 @@ class Map {
           Coordinate candidate = position;
 
           if (with_harmonics) {
-            antinodes.insert(candidate);
+            antinodes.Insert(candidate);
           }
 
           while (true) {
@@ -203,7 +208,7 @@ class Map {
             if (IsOutOfBounds(candidate)) {
               break;
             }
-            antinodes.insert(candidate);
+            antinodes.Insert(candidate);
             if (!with_harmonics) {
               break;
             }
@@ -211,7 +216,6 @@ class Map {
         }
       }
     }
-    return antinodes;
   }
 
   void Print() {
@@ -240,18 +244,17 @@ class Map {
   std::vector<std::string> map_;
 };
 
-int main() {
-  Map map{aoc::LoadStringsFromFileByLine("./2024/day8.txt")};
-
-  // Keep a set of antinode coordinates.
-  absl::flat_hash_set<Coordinate> antinodes =
-      map.ComputeAntinodes(/*with_harmonics=*/false);
-  absl::flat_hash_set<Coordinate> harmonic_antinodes =
-      map.ComputeAntinodes(/*with_harmonics=*/true);
+Map Parse(std::string_view input) { return Map(aoc::SplitLines(input)); }
 
-  map.Print();
-  std::print("There are {} antinodes.\n", antinodes.size());
-  std::print("There are {} harmonic antinodes.\n", harmonic_antinodes.size());
+size_t Part1(const Map& map) {
+  return map.ComputeAntinodes(/*with_harmonics=*/false).Size();
+}
 
-  return 0;
+size_t Part2(const Map& map) {
+  return map.ComputeAntinodes(/*with_harmonics=*/true).Size();
 }
+
+}  // namespace
+
+AOC_REGISTER_DAY({.year = 2024, .day = 8, .input_file = "./2024/day8.txt"},
+                 Parse, Part1, Part2);
@@ -0,0 +1,27 @@
+// Generates 2024 day 8 inputs: a --size by --size map where 9% of the cells
+// hold an antenna with one of 62 frequencies.
+
+#include <cstdint>
+
+#include "utils/gen.h"
+
+namespace {
+
+void Generate(aoc::Generator& gen) {
+  constexpr char kFrequencies[] =
+      "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+  for (int64_t row = 0; row < gen.size(); ++row) {
+    for (int64_t col = 0; col < gen.size(); ++col) {
+      gen.Write(gen.Chance(0.09) ? gen.Pick(kFrequencies) : '.');
+    }
+    gen.Write('\n');
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  return aoc::RunGenerator(
+      argc, argv, {.default_size = 50, .size_unit = "rows and columns"},
+      Generate);
+}
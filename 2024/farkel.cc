@@ -3,12 +3,14 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstdint>
 #include <print>
 #include <random>
 #include <vector>
 
 #include "absl/log/check.h"
+#include "utils/thread_pool.h"
 #include "utils/utils.h"
 
 // There are 6 dice in this game.
@@ -442,40 +444,38 @@ void PrintFractionsAndPercentages(
 class Game {
  public:
   Game(std::vector<std::unique_ptr<Strategy>> players)
-      : players_(std::move(players)),
-        scores_(players_.size(), 0),
-        num_wins_(players_.size(), 0) {}
+      : players_(std::move(players)) {}
 
+  // Games are independent (strategies are const and every thread rolls its
+  // own dice), so they are played in parallel.
   void SimulateGames(int target_score, int num_games) {
-    for (int i = 0; i < num_games; ++i) {
-      PlayGame(target_score);
-    }
-    PrintFractionsAndPercentages(players_, num_wins_);
+    std::vector<std::atomic<int>> wins(players_.size());
+    aoc::ParallelFor(0, num_games, [&](int64_t) {
+      wins[PlayGame(target_score)].fetch_add(1, std::memory_order_relaxed);
+    });
+    std::vector<int> num_wins(wins.begin(), wins.end());
+    PrintFractionsAndPercentages(players_, num_wins);
   }
 
  private:
-  void PlayGame(int target_score) {
-    ClearScores();
+  // Returns the index of the winning player.
+  int PlayGame(int target_score) const {
+    std::vector<int> scores(players_.size(), 0);
     bool we_have_a_winner = false;
 
     while (!we_have_a_winner) {
       for (int player = 0; player < players_.size(); ++player) {
-        scores_[player] += TakeTurn(*players_[player]);
-        if (scores_[player] > target_score) {
+        scores[player] += TakeTurn(*players_[player]);
+        if (scores[player] > target_score) {
           we_have_a_winner = true;
         }
       }
     }
-    int winning_player = std::distance(
-        scores_.begin(), std::max_element(scores_.begin(), scores_.end()));
-    num_wins_[winning_player]++;
+    return std::distance(scores.begin(),
+                         std::max_element(scores.begin(), scores.end()));
   }
 
-  void ClearScores() { std::fill(scores_.begin(), scores_.end(), 0); }
-
   std::vector<std::unique_ptr<Strategy>> players_;
-  std::vector<int> scores_{};
-  std::vector<int> num_wins_{};
 };
 
 // Keep going till only 1 die: 370 mean, 550 std dev, 47% farkel.
@@ -0,0 +1,103 @@
+// Sends inputs to a running //daemon:aoc_daemon and prints the answers, the
+// way a grading service would.
+//
+// Usage:
+//   aoc_client --day=2015/day7                  The day's own input.
+//   aoc_client --day=2015/day7 a.txt b.txt      These inputs, in order.
+//   aoc_client --day=2015/day7 --part=2 a.txt   Only part 2.
+
+#include <unistd.h>
+
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <print>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "daemon/protocol.h"
+
+ABSL_FLAG(std::string, socket, "/tmp/aoc.sock",
+          "The Unix domain socket the daemon listens on.");
+ABSL_FLAG(std::string, day, "",
+          "The day to solve, as printed by DayName, e.g. 2015/day7.");
+ABSL_FLAG(int, part, 0, "The part to solve, or 0 for both.");
+
+namespace {
+
+absl::StatusOr<std::string> ReadFile(const char* path) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return absl::NotFoundError(std::format("Could not read {}", path));
+  }
+  return std::string((std::istreambuf_iterator<char>(file)),
+                     std::istreambuf_iterator<char>());
+}
+
+// Asks for one part and prints the answer. Returns false if there isn't one.
+bool Ask(int fd, const aoc::SolveRequest& request) {
+  absl::Status status = aoc::WriteRequest(fd, request);
+  absl::StatusOr<aoc::SolveResponse> response;
+  if (status.ok()) {
+    response = aoc::ReadResponse(fd);
+    status = response.ok() ? response->status : response.status();
+  }
+  if (!status.ok()) {
+    std::print(stderr, "Part {}: {}\n", request.part, status.ToString());
+    return false;
+  }
+  std::print("Part {}: {}\n", request.part, response->answer);
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::vector<char*> args = absl::ParseCommandLine(argc, argv);
+  const std::string day = absl::GetFlag(FLAGS_day);
+  const int part = absl::GetFlag(FLAGS_part);
+  if (day.empty() || part < 0 || part > 2) {
+    std::print(stderr, "Usage: {} --day=YEAR/dayN [--part=1|2] [INPUT...]\n",
+               args[0]);
+    return 1;
+  }
+
+  absl::StatusOr<int> fd = aoc::ConnectUnix(absl::GetFlag(FLAGS_socket));
+  if (!fd.ok()) {
+    std::print(stderr, "{}\n", fd.status().ToString());
+    return 1;
+  }
+
+  // An empty input asks for the day's own.
+  std::vector<std::string> inputs;
+  if (args.size() == 1) {
+    inputs.emplace_back();
+  }
+  for (size_t i = 1; i < args.size(); ++i) {
+    absl::StatusOr<std::string> input = ReadFile(args[i]);
+    if (!input.ok()) {
+      std::print(stderr, "{}\n", input.status().ToString());
+      return 1;
+    }
+    inputs.push_back(*std::move(input));
+  }
+
+  bool ok = true;
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    if (args.size() > 2) {
+      std::print("{}:\n", args[i + 1]);
+    }
+    for (int p = 1; p <= 2; ++p) {
+      if (part == 0 || part == p) {
+        ok &= Ask(*fd, {.day = day, .part = p, .input = inputs[i]});
+      }
+    }
+  }
+  ::close(*fd);
+  return ok ? 0 : 1;
+}
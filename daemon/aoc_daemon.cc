@@ -0,0 +1,191 @@
+// Solves puzzle inputs sent over a Unix domain socket (daemon/protocol.h), so
+// that a caller solving many inputs pays for neither process startup nor
+// solver setup on each one.
+//
+// Usage:
+//   bazel run -c opt //daemon:aoc_daemon -- --socket=/tmp/aoc.sock
+//   bazel-bin/daemon/aoc_client --socket=/tmp/aoc.sock --day=2015/day7 in.txt
+//
+// The days CHECK-fail on input they can't make sense of, which kills the
+// daemon; see daemon/protocol.h.
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <format>
+#include <memory>
+#include <print>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/synchronization/mutex.h"
+#include "daemon/protocol.h"
+#include "utils/day.h"
+#include "utils/thread_pool.h"
+#include "utils/utils.h"
+
+ABSL_FLAG(std::string, socket, "/tmp/aoc.sock",
+          "Listen on a Unix domain socket at this path.");
+ABSL_FLAG(int, threads, 0,
+          "How many connections to serve at once. 0 means one per hardware "
+          "thread.");
+ABSL_FLAG(bool, warm, false,
+          "Solve every day's own input once before listening, so the first "
+          "request for each day doesn't pay for its setup.");
+
+namespace {
+
+// Every linked-in day, with the Days that are not serving a request right
+// now. Days are reused, so whatever a Day builds up outside Parse() (lookup
+// tables, scratch space) is only paid for once per concurrent request.
+class Solvers {
+ public:
+  explicit Solvers(std::vector<aoc::RegisteredDay> days) {
+    for (aoc::RegisteredDay& day : days) {
+      auto entry = std::make_unique<Entry>();
+      entry->name = aoc::DayName(day.info);
+      entry->day = std::move(day);
+      entries_[entry->name] = std::move(entry);
+    }
+  }
+
+  absl::StatusOr<std::string> Solve(const aoc::SolveRequest& request) {
+    auto it = entries_.find(request.day);
+    if (it == entries_.end()) {
+      return absl::NotFoundError(
+          std::format("No day named \"{}\".", request.day));
+    }
+    Entry& entry = *it->second;
+    std::unique_ptr<aoc::Day> day = entry.Acquire();
+    // Days may keep views into their input, so it must outlive the parts.
+    absl::StatusOr<aoc::DayInput> input;
+    if (request.input.empty()) {
+      input = aoc::DayInput::Open(entry.day.info);
+      if (!input.ok()) {
+        entry.Release(std::move(day));
+        return input.status();
+      }
+      day->Parse(input->Contents());
+    } else {
+      day->Parse(request.input);
+    }
+    std::string answer = request.part == 1 ? day->Part1() : day->Part2();
+    entry.Release(std::move(day));
+    return answer;
+  }
+
+  // Solves both parts of every day's own input.
+  void Warm() {
+    for (const auto& [name, entry] : entries_) {
+      for (int part : {1, 2}) {
+        absl::StatusOr<std::string> answer =
+            Solve({.day = name, .part = part});
+        if (!answer.ok()) {
+          std::print(stderr, "Warming {}: {}\n", name,
+                     answer.status().ToString());
+        }
+      }
+    }
+  }
+
+ private:
+  struct Entry {
+    std::string name;
+    aoc::RegisteredDay day;
+    absl::Mutex mu;
+    std::vector<std::unique_ptr<aoc::Day>> idle ABSL_GUARDED_BY(mu);
+
+    std::unique_ptr<aoc::Day> Acquire() {
+      {
+        absl::MutexLock lock(&mu);
+        if (!idle.empty()) {
+          std::unique_ptr<aoc::Day> solver = std::move(idle.back());
+          idle.pop_back();
+          return solver;
+        }
+      }
+      return day.make();
+    }
+
+    void Release(std::unique_ptr<aoc::Day> solver) {
+      absl::MutexLock lock(&mu);
+      idle.push_back(std::move(solver));
+    }
+  };
+
+  // Built once before serving, then only read.
+  absl::flat_hash_map<std::string, std::unique_ptr<Entry>> entries_;
+};
+
+// Answers requests on `fd` until the client hangs up.
+void Serve(Solvers& solvers, int fd) {
+  while (true) {
+    aoc::SolveResponse response;
+    absl::StatusOr<aoc::SolveRequest> request = aoc::ReadRequest(fd);
+    if (request.ok()) {
+      absl::StatusOr<std::string> answer = solvers.Solve(*request);
+      if (answer.ok()) {
+        response.answer = *std::move(answer);
+      } else {
+        response.status = answer.status();
+      }
+    } else if (absl::IsInvalidArgument(request.status())) {
+      response.status = request.status();
+    } else {
+      if (!absl::IsOutOfRange(request.status())) {
+        AOC_LOG(ERROR, "Dropping connection: {}", request.status().ToString());
+      }
+      break;
+    }
+    if (absl::Status status = aoc::WriteResponse(fd, response); !status.ok()) {
+      AOC_LOG(ERROR, "Dropping connection: {}", status.ToString());
+      break;
+    }
+  }
+  ::close(fd);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  absl::ParseCommandLine(argc, argv);
+
+  Solvers solvers(aoc::RegisteredDays());
+  if (absl::GetFlag(FLAGS_warm)) {
+    solvers.Warm();
+  }
+
+  const std::string path = absl::GetFlag(FLAGS_socket);
+  absl::StatusOr<int> listener = aoc::ListenUnix(path);
+  if (!listener.ok()) {
+    std::print(stderr, "{}\n", listener.status().ToString());
+    return 1;
+  }
+
+  // Connections get their own pool: a client that keeps its connection open
+  // holds a thread, and that must not starve days that parallelize on the
+  // default pool.
+  int threads = absl::GetFlag(FLAGS_threads);
+  if (threads <= 0) {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  aoc::ThreadPool connections(threads);
+  std::print(stderr, "Listening on {} with {} threads.\n", path, threads);
+
+  while (true) {
+    absl::StatusOr<int> fd = aoc::AcceptUnix(*listener);
+    if (!fd.ok()) {
+      std::print(stderr, "{}\n", fd.status().ToString());
+      return 1;
+    }
+    connections.Schedule([&solvers, fd = *fd] { Serve(solvers, fd); });
+  }
+}
@@ -0,0 +1,260 @@
+#include "daemon/protocol.h"
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/numbers.h"
+
+namespace aoc {
+namespace {
+
+absl::Status ErrnoError(std::string_view what) {
+  return absl::UnavailableError(
+      std::format("{}: {}", what, std::strerror(errno)));
+}
+
+// Sends without raising SIGPIPE, so a client that hangs up is an error rather
+// than the end of the daemon. Where send() has no MSG_NOSIGNAL (macOS),
+// ConfigureSocket sets SO_NOSIGPIPE on the socket instead.
+#if defined(MSG_NOSIGNAL)
+constexpr int kSendFlags = MSG_NOSIGNAL;
+#else
+constexpr int kSendFlags = 0;
+#endif
+
+// Marks `fd` close-on-exec and, where that is how it's done, keeps writes to
+// it from raising SIGPIPE. Closes `fd` on failure.
+absl::Status ConfigureSocket(int fd) {
+  if (::fcntl(fd, F_SETFD, FD_CLOEXEC) != 0) {
+    absl::Status status = ErrnoError("fcntl");
+    ::close(fd);
+    return status;
+  }
+#if defined(SO_NOSIGPIPE)
+  const int on = 1;
+  if (::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on)) != 0) {
+    absl::Status status = ErrnoError("setsockopt");
+    ::close(fd);
+    return status;
+  }
+#endif
+  return absl::OkStatus();
+}
+
+// A new Unix domain stream socket, configured by ConfigureSocket.
+absl::StatusOr<int> UnixSocket() {
+  int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0) return ErrnoError("socket");
+  if (absl::Status status = ConfigureSocket(fd); !status.ok()) return status;
+  return fd;
+}
+
+absl::StatusOr<sockaddr_un> UnixAddress(const std::string& path) {
+  sockaddr_un address = {};
+  address.sun_family = AF_UNIX;
+  if (path.size() >= sizeof(address.sun_path)) {
+    return absl::InvalidArgumentError(
+        std::format("Socket path too long: {}", path));
+  }
+  std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+  return address;
+}
+
+// Reads exactly `size` bytes. Returns false on a clean hangup before the
+// first byte.
+absl::StatusOr<bool> ReadExactly(int fd, char* data, size_t size) {
+  size_t done = 0;
+  while (done < size) {
+    ssize_t n = ::read(fd, data + done, size - done);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      return ErrnoError("read");
+    }
+    if (n == 0) {
+      if (done == 0) return false;
+      return absl::DataLossError("Connection closed mid-message.");
+    }
+    done += n;
+  }
+  return true;
+}
+
+absl::Status WriteAll(int fd, std::string_view data) {
+  while (!data.empty()) {
+    ssize_t n = ::send(fd, data.data(), data.size(), kSendFlags);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      return ErrnoError("send");
+    }
+    data.remove_prefix(n);
+  }
+  return absl::OkStatus();
+}
+
+void AppendField(std::string& message, std::string_view field) {
+  const uint32_t size = field.size();
+  for (int shift = 0; shift < 32; shift += 8) {
+    message.push_back(static_cast<char>((size >> shift) & 0xff));
+  }
+  message.append(field);
+}
+
+// Reads one field. A clean hangup before it is OutOfRangeError.
+absl::StatusOr<std::string> ReadField(int fd) {
+  unsigned char header[4];
+  absl::StatusOr<bool> read =
+      ReadExactly(fd, reinterpret_cast<char*>(header), sizeof(header));
+  if (!read.ok()) return read.status();
+  if (!*read) return absl::OutOfRangeError("Connection closed.");
+  const uint32_t size = header[0] | header[1] << 8 | header[2] << 16 |
+                        static_cast<uint32_t>(header[3]) << 24;
+  if (size > kMaxFieldBytes) {
+    return absl::ResourceExhaustedError(
+        std::format("Field of {} bytes is too big.", size));
+  }
+  std::string field(size, '\0');
+  read = ReadExactly(fd, field.data(), size);
+  if (!read.ok()) return read.status();
+  if (!*read) return absl::DataLossError("Connection closed mid-message.");
+  return field;
+}
+
+// Reads the remaining fields of a message whose first field has been read;
+// hanging up now is always an error.
+absl::StatusOr<std::string> ReadNextField(int fd) {
+  absl::StatusOr<std::string> field = ReadField(fd);
+  if (absl::IsOutOfRange(field.status())) {
+    return absl::DataLossError("Connection closed mid-message.");
+  }
+  return field;
+}
+
+}  // namespace
+
+absl::StatusOr<int> ListenUnix(const std::string& path) {
+  absl::StatusOr<sockaddr_un> address = UnixAddress(path);
+  if (!address.ok()) return address.status();
+  struct stat existing;
+  if (::lstat(path.c_str(), &existing) == 0) {
+    if (!S_ISSOCK(existing.st_mode)) {
+      return absl::FailedPreconditionError(
+          std::format("{} exists and is not a socket.", path));
+    }
+    ::unlink(path.c_str());
+  }
+  absl::StatusOr<int> socket = UnixSocket();
+  if (!socket.ok()) return socket.status();
+  const int fd = *socket;
+  if (::bind(fd, reinterpret_cast<const sockaddr*>(&*address),
+             sizeof(*address)) != 0 ||
+      ::listen(fd, SOMAXCONN) != 0) {
+    absl::Status status = ErrnoError(std::format("Listening on {}", path));
+    ::close(fd);
+    return status;
+  }
+  return fd;
+}
+
+absl::StatusOr<int> ConnectUnix(const std::string& path) {
+  absl::StatusOr<sockaddr_un> address = UnixAddress(path);
+  if (!address.ok()) return address.status();
+  absl::StatusOr<int> socket = UnixSocket();
+  if (!socket.ok()) return socket.status();
+  const int fd = *socket;
+  if (::connect(fd, reinterpret_cast<const sockaddr*>(&*address),
+                sizeof(*address)) != 0) {
+    absl::Status status = ErrnoError(std::format("Connecting to {}", path));
+    ::close(fd);
+    return status;
+  }
+  return fd;
+}
+
+absl::StatusOr<int> AcceptUnix(int listener) {
+  while (true) {
+    int fd = ::accept(listener, nullptr, nullptr);
+    if (fd < 0) {
+      if (errno == EINTR || errno == ECONNABORTED) continue;
+      return ErrnoError("accept");
+    }
+    if (absl::Status status = ConfigureSocket(fd); !status.ok()) {
+      return status;
+    }
+    return fd;
+  }
+}
+
+absl::StatusOr<SolveRequest> ReadRequest(int fd) {
+  absl::StatusOr<std::string> day = ReadField(fd);
+  if (!day.ok()) return day.status();
+  absl::StatusOr<std::string> part = ReadNextField(fd);
+  if (!part.ok()) return part.status();
+  absl::StatusOr<std::string> input = ReadNextField(fd);
+  if (!input.ok()) return input.status();
+  if (*part != "1" && *part != "2") {
+    return absl::InvalidArgumentError(
+        std::format("Bad part \"{}\", expected 1 or 2.", *part));
+  }
+  return SolveRequest{.day = *std::move(day),
+                      .part = *part == "1" ? 1 : 2,
+                      .input = *std::move(input)};
+}
+
+absl::Status WriteRequest(int fd, const SolveRequest& request) {
+  if (request.input.size() > kMaxFieldBytes) {
+    return absl::InvalidArgumentError(
+        std::format("Input of {} bytes is too big; the limit is {}.",
+                    request.input.size(), kMaxFieldBytes));
+  }
+  std::string message;
+  AppendField(message, request.day);
+  AppendField(message, std::format("{}", request.part));
+  AppendField(message, request.input);
+  return WriteAll(fd, message);
+}
+
+absl::StatusOr<SolveResponse> ReadResponse(int fd) {
+  absl::StatusOr<std::string> status = ReadField(fd);
+  if (!status.ok()) return status.status();
+  absl::StatusOr<std::string> body = ReadNextField(fd);
+  if (!body.ok()) return body.status();
+  SolveResponse response;
+  int code = 0;
+  if (*status == "ok") {
+    response.answer = *std::move(body);
+  } else if (absl::SimpleAtoi(*status, &code) && code > 0) {
+    response.status = absl::Status(static_cast<absl::StatusCode>(code), *body);
+  } else {
+    return absl::DataLossError(
+        std::format("Bad response status \"{}\".", *status));
+  }
+  return response;
+}
+
+absl::Status WriteResponse(int fd, const SolveResponse& response) {
+  std::string message;
+  if (response.status.ok()) {
+    AppendField(message, "ok");
+    AppendField(message, response.answer);
+  } else {
+    AppendField(message,
+                std::format("{}", static_cast<int>(response.status.code())));
+    AppendField(message, std::string(response.status.message()));
+  }
+  return WriteAll(fd, message);
+}
+
+}  // namespace aoc
@@ -0,0 +1,66 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+
+namespace aoc {
+
+// The wire protocol between //daemon:aoc_daemon and its clients.
+//
+// A connection carries any number of request/response pairs, one after
+// another. Every message is a sequence of fields, and every field is a
+// 4-byte little-endian length followed by that many bytes:
+//
+//   request:  day ("2015/day7", as printed by DayName), part ("1" or "2"),
+//             input (empty to solve the day's own input)
+//   response: status ("ok", or an absl::StatusCode as a decimal number),
+//             answer or error message
+//
+// No field, the input included, may be longer than kMaxFieldBytes, so a
+// client can't make the daemon allocate more than that per field. Real puzzle
+// inputs are tens of KiB.
+//
+// The days assume well-formed puzzle input. A malformed one can trip a CHECK
+// in a day, and that takes down the whole daemon, so only serve clients you
+// trust with inputs they got from Advent of Code.
+inline constexpr int64_t kMaxFieldBytes = int64_t{8} << 20;
+
+struct SolveRequest {
+  std::string day;
+  int part = 0;
+  std::string input;
+};
+
+struct SolveResponse {
+  // The answer if ok, otherwise why there isn't one.
+  absl::Status status;
+  std::string answer;
+};
+
+// Listens on a Unix domain socket at `path`, replacing any stale socket file
+// left behind by an earlier daemon. Fails rather than replace anything at
+// `path` that isn't a socket.
+absl::StatusOr<int> ListenUnix(const std::string& path);
+// Connects to the daemon listening at `path`.
+absl::StatusOr<int> ConnectUnix(const std::string& path);
+// Waits for the next connection on a ListenUnix() socket.
+absl::StatusOr<int> AcceptUnix(int listener);
+//
+// The sockets all three return are close-on-exec, and writing to one whose
+// peer has hung up fails with EPIPE instead of raising SIGPIPE.
+
+// Reads the next request. OutOfRangeError means the client hung up cleanly
+// between requests. InvalidArgumentError means the request was read but makes
+// no sense, and the connection can carry on.
+absl::StatusOr<SolveRequest> ReadRequest(int fd);
+// InvalidArgumentError, without writing anything, if the input is longer than
+// kMaxFieldBytes.
+absl::Status WriteRequest(int fd, const SolveRequest& request);
+
+absl::StatusOr<SolveResponse> ReadResponse(int fd);
+absl::Status WriteResponse(int fd, const SolveResponse& response);
+
+}  // namespace aoc
@@ -0,0 +1,204 @@
+#include "daemon/protocol.h"
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "gtest/gtest.h"
+
+namespace aoc {
+namespace {
+
+// A connected pair of sockets, closed on destruction.
+class SocketPair {
+ public:
+  SocketPair() {
+    EXPECT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds_), 0);
+  }
+  ~SocketPair() {
+    Close(0);
+    Close(1);
+  }
+
+  int client() const { return fds_[0]; }
+  int server() const { return fds_[1]; }
+  void CloseClient() { Close(0); }
+
+ private:
+  void Close(int i) {
+    if (fds_[i] >= 0) {
+      ::close(fds_[i]);
+      fds_[i] = -1;
+    }
+  }
+
+  int fds_[2] = {-1, -1};
+};
+
+std::string TempPath(const std::string& name) {
+  const char* dir = std::getenv("TEST_TMPDIR");
+  return std::string(dir != nullptr ? dir : "/tmp") + "/" + name;
+}
+
+TEST(ProtocolTest, RequestRoundTrips) {
+  SocketPair sockets;
+  const SolveRequest sent = {
+      .day = "2015/day7", .part = 2, .input = "123 -> x\n456 -> y\n"};
+  ASSERT_TRUE(WriteRequest(sockets.client(), sent).ok());
+
+  absl::StatusOr<SolveRequest> received = ReadRequest(sockets.server());
+  ASSERT_TRUE(received.ok()) << received.status();
+  EXPECT_EQ(received->day, sent.day);
+  EXPECT_EQ(received->part, sent.part);
+  EXPECT_EQ(received->input, sent.input);
+}
+
+TEST(ProtocolTest, EmptyInputRoundTrips) {
+  SocketPair sockets;
+  ASSERT_TRUE(WriteRequest(sockets.client(), {.day = "2024/day1", .part = 1})
+                  .ok());
+
+  absl::StatusOr<SolveRequest> received = ReadRequest(sockets.server());
+  ASSERT_TRUE(received.ok()) << received.status();
+  EXPECT_EQ(received->day, "2024/day1");
+  EXPECT_EQ(received->part, 1);
+  EXPECT_EQ(received->input, "");
+}
+
+TEST(ProtocolTest, AnswerRoundTrips) {
+  SocketPair sockets;
+  ASSERT_TRUE(WriteResponse(sockets.server(), {.answer = "956"}).ok());
+
+  absl::StatusOr<SolveResponse> received = ReadResponse(sockets.client());
+  ASSERT_TRUE(received.ok()) << received.status();
+  EXPECT_TRUE(received->status.ok());
+  EXPECT_EQ(received->answer, "956");
+}
+
+TEST(ProtocolTest, ErrorRoundTrips) {
+  SocketPair sockets;
+  const absl::Status error = absl::NotFoundError("No day named \"2015/26\".");
+  ASSERT_TRUE(WriteResponse(sockets.server(), {.status = error}).ok());
+
+  absl::StatusOr<SolveResponse> received = ReadResponse(sockets.client());
+  ASSERT_TRUE(received.ok()) << received.status();
+  EXPECT_EQ(received->status, error);
+}
+
+TEST(ProtocolTest, SeveralRequestsShareAConnection) {
+  SocketPair sockets;
+  for (int part : {1, 2}) {
+    ASSERT_TRUE(
+        WriteRequest(sockets.client(), {.day = "2015/day1", .part = part})
+            .ok());
+  }
+  for (int part : {1, 2}) {
+    absl::StatusOr<SolveRequest> received = ReadRequest(sockets.server());
+    ASSERT_TRUE(received.ok()) << received.status();
+    EXPECT_EQ(received->part, part);
+  }
+}
+
+TEST(ProtocolTest, HangupBetweenRequestsIsOutOfRange) {
+  SocketPair sockets;
+  sockets.CloseClient();
+  EXPECT_TRUE(absl::IsOutOfRange(ReadRequest(sockets.server()).status()));
+}
+
+TEST(ProtocolTest, BadPartIsInvalidArgument) {
+  SocketPair sockets;
+  ASSERT_TRUE(
+      WriteRequest(sockets.client(), {.day = "2015/day1", .part = 3}).ok());
+  EXPECT_TRUE(
+      absl::IsInvalidArgument(ReadRequest(sockets.server()).status()));
+}
+
+TEST(ProtocolTest, OversizedInputIsNotSent) {
+  SocketPair sockets;
+  const SolveRequest request = {.day = "2015/day1",
+                                .part = 1,
+                                .input = std::string(kMaxFieldBytes + 1, '(')};
+  EXPECT_TRUE(absl::IsInvalidArgument(WriteRequest(sockets.client(), request)));
+}
+
+TEST(ProtocolTest, OversizedFieldIsRejected) {
+  SocketPair sockets;
+  // A day field claiming to be one byte over the limit.
+  const uint32_t size = kMaxFieldBytes + 1;
+  const unsigned char header[4] = {
+      static_cast<unsigned char>(size), static_cast<unsigned char>(size >> 8),
+      static_cast<unsigned char>(size >> 16),
+      static_cast<unsigned char>(size >> 24)};
+  ASSERT_EQ(::write(sockets.client(), header, sizeof(header)), 4);
+  EXPECT_TRUE(
+      absl::IsResourceExhausted(ReadRequest(sockets.server()).status()));
+}
+
+TEST(ProtocolTest, ListenConnectRoundTrip) {
+  const std::string path = TempPath("protocol_test.sock");
+  absl::StatusOr<int> listener = ListenUnix(path);
+  ASSERT_TRUE(listener.ok()) << listener.status();
+  absl::StatusOr<int> client = ConnectUnix(path);
+  ASSERT_TRUE(client.ok()) << client.status();
+  absl::StatusOr<int> accepted = AcceptUnix(*listener);
+  ASSERT_TRUE(accepted.ok()) << accepted.status();
+  const int server = *accepted;
+
+  ASSERT_TRUE(WriteRequest(*client, {.day = "2015/day1", .part = 1}).ok());
+  absl::StatusOr<SolveRequest> request = ReadRequest(server);
+  ASSERT_TRUE(request.ok()) << request.status();
+  EXPECT_EQ(request->day, "2015/day1");
+
+  ::close(server);
+  ::close(*client);
+  ::close(*listener);
+
+  // The socket file is left behind, and the next daemon replaces it.
+  listener = ListenUnix(path);
+  ASSERT_TRUE(listener.ok()) << listener.status();
+  ::close(*listener);
+  ::unlink(path.c_str());
+}
+
+TEST(ProtocolTest, ListenLeavesOtherFilesAlone) {
+  const std::string path = TempPath("protocol_test.txt");
+  std::ofstream(path) << "not a socket\n";
+
+  EXPECT_TRUE(absl::IsFailedPrecondition(ListenUnix(path).status()));
+  std::ifstream file(path);
+  std::string contents;
+  std::getline(file, contents);
+  EXPECT_EQ(contents, "not a socket");
+  ::unlink(path.c_str());
+}
+
+TEST(ProtocolTest, WritingToAHungUpPeerFails) {
+  const std::string path = TempPath("protocol_test_hangup.sock");
+  absl::StatusOr<int> listener = ListenUnix(path);
+  ASSERT_TRUE(listener.ok()) << listener.status();
+  absl::StatusOr<int> client = ConnectUnix(path);
+  ASSERT_TRUE(client.ok()) << client.status();
+  absl::StatusOr<int> server = AcceptUnix(*listener);
+  ASSERT_TRUE(server.ok()) << server.status();
+  ::close(*client);
+
+  // Without MSG_NOSIGNAL or SO_NOSIGPIPE this would kill the test.
+  absl::Status status = absl::OkStatus();
+  for (int i = 0; i < 8 && status.ok(); ++i) {
+    status = WriteResponse(*server, {.answer = std::string(1 << 16, 'x')});
+  }
+  EXPECT_FALSE(status.ok());
+
+  ::close(*server);
+  ::close(*listener);
+  ::unlink(path.c_str());
+}
+
+}  // namespace
+}  // namespace aoc
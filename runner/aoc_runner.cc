@@ -0,0 +1,372 @@
+// Runs any set of days in one process, spread across the default thread pool,
+// and prints how long each phase of each day took.
+//
+// Usage:
+//   bazel run -c opt //runner:aoc_runner
+//   bazel run -c opt //runner:aoc_runner -- --days=2015
+//   bazel run -c opt //runner:aoc_runner -- --days=2015/7,2024/10
+//   bazel run -c opt //runner:aoc_runner -- --noparallel
+//   bazel run -c opt //runner:aoc_runner -- --trace_json=/tmp/trace.json
+//
+// Checking answers, times and allocations against runner/budgets.json
+// (runner/budgets.h), and refreshing the budgets:
+//   bazel run -c opt //runner:aoc_runner -- --budgets=runner/budgets.json
+//   bazel run -c opt //runner:aoc_runner -- --budgets=runner/budgets.json
+//       --update_budgets
+//
+// Allocations are only counted, checked and updated when the runner is built
+// with --config=alloc.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+#include <memory>
+#include <optional>
+#include <print>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "runner/budgets.h"
+#include "utils/alloc_stats.h"
+#include "utils/bench.h"
+#include "utils/day.h"
+#include "utils/thread_pool.h"
+#include "utils/trace.h"
+#include "utils/utils.h"
+
+ABSL_FLAG(std::vector<std::string>, days, {},
+          "Days to run, each as YEAR or YEAR/DAY. Runs every day when empty.");
+ABSL_FLAG(bool, parallel, true,
+          "Run days concurrently on the default thread pool. With "
+          "--noparallel, days run one after another on the main thread.");
+ABSL_FLAG(std::string, budgets, "",
+          "Check answers, times and allocations against this budgets file "
+          "and fail on any regression. Relative paths are relative to the "
+          "workspace under bazel run. Implies --noparallel.");
+ABSL_FLAG(bool, update_budgets, false,
+          "With --budgets, record this run's results as the new budgets for "
+          "the selected days instead of checking them.");
+ABSL_FLAG(int, budget_runs, 3,
+          "With --budgets, solve each day this many times and keep the "
+          "fastest.");
+ABSL_FLAG(double, time_tolerance, 0.5,
+          "With --budgets, how far over its time budget a day may go, as a "
+          "fraction of the budget.");
+ABSL_FLAG(double, alloc_tolerance, 0.1,
+          "With --budgets, how far over its allocation budget a day may go, "
+          "as a fraction of the budget.");
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct DaySelector {
+  int64_t year = 0;
+  // Every day of the year when unset.
+  std::optional<int64_t> day;
+};
+
+absl::StatusOr<DaySelector> ParseSelector(std::string_view spec) {
+  std::vector<std::string_view> parts;
+  for (std::string_view part : aoc::Split(spec, "/")) {
+    parts.push_back(part);
+  }
+  if (parts.empty() || parts.size() > 2) {
+    return absl::InvalidArgumentError(
+        std::format("Bad day \"{}\", expected YEAR or YEAR/DAY.", spec));
+  }
+  DaySelector selector;
+  absl::StatusOr<int64_t> year = aoc::ConvertStringViewToInt64(parts[0]);
+  if (!year.ok()) {
+    return year.status();
+  }
+  selector.year = *year;
+  if (parts.size() == 2) {
+    absl::StatusOr<int64_t> day = aoc::ConvertStringViewToInt64(parts[1]);
+    if (!day.ok()) {
+      return day.status();
+    }
+    selector.day = *day;
+  }
+  return selector;
+}
+
+bool Selected(const aoc::DayInfo& info,
+              const std::vector<DaySelector>& selectors) {
+  if (selectors.empty()) {
+    return true;
+  }
+  for (const DaySelector& selector : selectors) {
+    if (selector.year == info.year &&
+        (!selector.day.has_value() || *selector.day == info.day)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+struct DayResult {
+  std::string name;
+  std::string part1;
+  std::string part2;
+  double parse_ns = 0;
+  double part1_ns = 0;
+  double part2_ns = 0;
+  // Heap allocations made by parse, part 1 and part 2, on any thread. Only
+  // meaningful when days run one at a time, as they do with --budgets.
+  int64_t allocations = 0;
+  // Set if the day could not be run.
+  std::string error;
+
+  double TotalNs() const { return parse_ns + part1_ns + part2_ns; }
+};
+
+template <typename F>
+double TimeNs(F&& fn) {
+  Clock::time_point start = Clock::now();
+  fn();
+  return std::chrono::duration<double, std::nano>(Clock::now() - start)
+      .count();
+}
+
+// Reads, parses and solves one day. Example checks are skipped; they are
+// cheap sanity checks for the single-day binaries, not part of the suite.
+// `name` must outlive the trace.
+DayResult Solve(const aoc::RegisteredDay& registered, std::string_view name) {
+  aoc::ScopedTimer day_timer(name);
+  DayResult result{.name = std::string(name)};
+  absl::StatusOr<aoc::DayInput> input;
+  {
+    AOC_SCOPED_TIMER("read");
+    input = aoc::DayInput::Open(registered.info);
+  }
+  if (!input.ok()) {
+    result.error = input.status().ToString();
+    return result;
+  }
+  std::unique_ptr<aoc::Day> day = registered.make();
+  aoc::AllocationCounter allocs(aoc::AllocScope::kProcess);
+  allocs.Start();
+  result.parse_ns = TimeNs([&] {
+    AOC_SCOPED_TIMER("parse");
+    day->Parse(input->Contents());
+  });
+  result.part1_ns = TimeNs([&] {
+    AOC_SCOPED_TIMER("part1");
+    result.part1 = day->Part1();
+  });
+  result.part2_ns = TimeNs([&] {
+    AOC_SCOPED_TIMER("part2");
+    result.part2 = day->Part2();
+  });
+  result.allocations = allocs.Stop().allocations;
+  return result;
+}
+
+void PrintResults(const std::vector<DayResult>& results, double wall_ns) {
+  std::print("\n{:<24} {:>10} {:>10} {:>10} {:>10}   {:<16} {}\n", "day",
+             "parse", "part1", "part2", "total", "part 1", "part 2");
+  double total_ns = 0;
+  for (const DayResult& result : results) {
+    if (!result.error.empty()) {
+      std::print("{:<24} {}\n", result.name, result.error);
+      continue;
+    }
+    total_ns += result.TotalNs();
+    std::print("{:<24} {:>10} {:>10} {:>10} {:>10}   {:<16} {}\n", result.name,
+               aoc::FormatNanoseconds(result.parse_ns),
+               aoc::FormatNanoseconds(result.part1_ns),
+               aoc::FormatNanoseconds(result.part2_ns),
+               aoc::FormatNanoseconds(result.TotalNs()), result.part1,
+               result.part2);
+  }
+  std::print("\n{} days. Sum of day times: {}. Wall time: {}.\n",
+             results.size(), aoc::FormatNanoseconds(total_ns),
+             aoc::FormatNanoseconds(wall_ns));
+}
+
+// The --budgets path, resolved against the workspace under bazel run.
+std::string BudgetsPath() {
+  std::string path = absl::GetFlag(FLAGS_budgets);
+  const char* workspace = std::getenv("BUILD_WORKSPACE_DIRECTORY");
+  if (workspace != nullptr && !path.starts_with("/")) {
+    path = std::format("{}/{}", workspace, path);
+  }
+  return path;
+}
+
+// What `result` measured, as a budget. Without the allocation hooks nothing
+// was counted, so the allocation budget is carried over from `old`.
+aoc::DayBudget Measured(const DayResult& result, const aoc::DayBudget& old) {
+  return {.part1 = result.part1,
+          .part2 = result.part2,
+          .time_ns = result.TotalNs(),
+          .allocations = aoc::AllocationTrackingAvailable()
+                             ? result.allocations
+                             : old.allocations};
+}
+
+void WarnIfNotCountingAllocations() {
+  if (!aoc::AllocationTrackingAvailable()) {
+    std::print(
+        "\nAllocation hooks not linked in, so allocation budgets are left "
+        "alone; build with --config=alloc to check them.\n");
+  }
+}
+
+// Records `results` as the budgets for their days, keeping everyone else's.
+int UpdateBudgets(const std::vector<DayResult>& results) {
+  const std::string path = BudgetsPath();
+  aoc::Budgets budgets;
+  if (absl::StatusOr<aoc::Budgets> old = aoc::ReadBudgets(path); old.ok()) {
+    budgets = *std::move(old);
+  }
+  for (const DayResult& result : results) {
+    if (result.error.empty()) {
+      budgets[result.name] = Measured(result, budgets[result.name]);
+    }
+  }
+  if (absl::Status status = aoc::WriteBudgets(path, budgets); !status.ok()) {
+    std::print(stderr, "{}\n", status.ToString());
+    return 1;
+  }
+  std::print("\nWrote {} budgets to {}.\n", results.size(), path);
+  return 0;
+}
+
+// Checks `results` against the budgets. Returns how many days failed.
+int CheckBudgets(const std::vector<DayResult>& results) {
+  const std::string path = BudgetsPath();
+  absl::StatusOr<aoc::Budgets> budgets = aoc::ReadBudgets(path);
+  if (!budgets.ok()) {
+    std::print(stderr, "{}\n", budgets.status().ToString());
+    return results.size();
+  }
+  const aoc::BudgetTolerance tolerance = {
+      .time = absl::GetFlag(FLAGS_time_tolerance),
+      .allocations = absl::GetFlag(FLAGS_alloc_tolerance),
+  };
+  int failures = 0;
+  std::print("\n");
+  for (const DayResult& result : results) {
+    auto budget = budgets->find(result.name);
+    if (!result.error.empty()) {
+      std::print("FAIL {}: {}\n", result.name, result.error);
+      ++failures;
+    } else if (budget == budgets->end()) {
+      std::print("NEW  {}: no budget; run with --update_budgets\n",
+                 result.name);
+    } else if (std::vector<std::string> violations = aoc::BudgetViolations(
+                   budget->second, Measured(result, budget->second),
+                   tolerance);
+               !violations.empty()) {
+      for (const std::string& violation : violations) {
+        std::print("FAIL {}: {}\n", result.name, violation);
+      }
+      ++failures;
+    }
+  }
+  std::print("{} of {} days within budget.\n", results.size() - failures,
+             results.size());
+  return failures;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  absl::ParseCommandLine(argc, argv);
+
+  std::vector<DaySelector> selectors;
+  for (const std::string& spec : absl::GetFlag(FLAGS_days)) {
+    absl::StatusOr<DaySelector> selector = ParseSelector(spec);
+    if (!selector.ok()) {
+      std::print(stderr, "{}\n", selector.status().ToString());
+      return 1;
+    }
+    selectors.push_back(*selector);
+  }
+
+  std::vector<aoc::RegisteredDay> days;
+  for (aoc::RegisteredDay& day : aoc::RegisteredDays()) {
+    if (Selected(day.info, selectors)) {
+      days.push_back(std::move(day));
+    }
+  }
+  if (days.empty()) {
+    std::print(stderr, "No days selected.\n");
+    return 1;
+  }
+
+  const std::string trace_path = absl::GetFlag(FLAGS_trace_json);
+  if (!trace_path.empty()) {
+    aoc::StartTracing();
+  }
+
+  // Trace events refer to these names, so they outlive the trace.
+  std::vector<std::string> names;
+  for (const aoc::RegisteredDay& day : days) {
+    names.push_back(aoc::DayName(day.info));
+  }
+  // Budgets compare times and process-wide allocation counts, so days must
+  // not share the machine or each other's threads.
+  const bool budgets = !absl::GetFlag(FLAGS_budgets).empty();
+  if (absl::GetFlag(FLAGS_update_budgets) && !budgets) {
+    std::print(stderr, "--update_budgets needs --budgets=PATH to update.\n");
+    return 1;
+  }
+  if (budgets) {
+    // Start the pool now, so that the first day to use it doesn't count the
+    // pool's own allocations. runner/day_test.cc does the same.
+    aoc::DefaultThreadPool();
+  }
+  const int runs = budgets ? std::max(1, absl::GetFlag(FLAGS_budget_runs)) : 1;
+  std::vector<DayResult> results(days.size());
+  double wall_ns = TimeNs([&] {
+    if (budgets || !absl::GetFlag(FLAGS_parallel)) {
+      for (size_t i = 0; i < days.size(); ++i) {
+        results[i] = Solve(days[i], names[i]);
+        for (int run = 1; run < runs; ++run) {
+          DayResult rerun = Solve(days[i], names[i]);
+          if (rerun.TotalNs() < results[i].TotalNs()) {
+            results[i] = std::move(rerun);
+          }
+        }
+      }
+      return;
+    }
+    // Days that parallelize internally share the same pool; a day waiting on
+    // its own tasks helps run whatever else is queued.
+    aoc::TaskGroup group(aoc::DefaultThreadPool());
+    for (size_t i = 0; i < days.size(); ++i) {
+      group.Run([&days, &names, &results, i] {
+        results[i] = Solve(days[i], names[i]);
+      });
+    }
+    group.Wait();
+  });
+
+  {
+    AOC_SCOPED_TIMER("output");
+    PrintResults(results, wall_ns);
+  }
+  if (absl::Status status = aoc::FinishTracing(trace_path); !status.ok()) {
+    std::print(stderr, "{}\n", status.ToString());
+    return 1;
+  }
+  if (budgets) {
+    WarnIfNotCountingAllocations();
+    if (absl::GetFlag(FLAGS_update_budgets)) {
+      return UpdateBudgets(results);
+    }
+    return CheckBudgets(results) == 0 ? 0 : 1;
+  }
+  return 0;
+}
@@ -0,0 +1,101 @@
+#include "runner/budgets.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "utils/bench.h"
+
+namespace aoc {
+
+using json = nlohmann::json;
+
+absl::StatusOr<Budgets> ReadBudgets(const std::string& path) {
+  std::ifstream file(path);
+  if (!file) {
+    return absl::NotFoundError(std::format("Could not read {}", path));
+  }
+  // Built without exceptions, so ask for a discarded value on bad JSON.
+  json root = json::parse(std::istreambuf_iterator<char>(file),
+                          std::istreambuf_iterator<char>(), nullptr,
+                          /*allow_exceptions=*/false);
+  if (!root.is_object()) {
+    return absl::InvalidArgumentError(
+        std::format("{} is not a JSON object", path));
+  }
+  Budgets budgets;
+  for (const auto& [name, entry] : root.items()) {
+    if (!entry.is_object()) {
+      return absl::InvalidArgumentError(
+          std::format("{}: budget for {} is not an object", path, name));
+    }
+    budgets[name] = {
+        .part1 = entry.value("part1", ""),
+        .part2 = entry.value("part2", ""),
+        .time_ns = entry.value("time_ns", 0.0),
+        .allocations = entry.value("allocations", int64_t{0}),
+    };
+  }
+  return budgets;
+}
+
+absl::Status WriteBudgets(const std::string& path, const Budgets& budgets) {
+  json root = json::object();
+  for (const auto& [name, budget] : budgets) {
+    root[name] = {
+        {"part1", budget.part1},
+        {"part2", budget.part2},
+        {"time_ns", static_cast<int64_t>(budget.time_ns)},
+        {"allocations", budget.allocations},
+    };
+  }
+  std::ofstream file(path);
+  file << root.dump(2) << "\n";
+  if (!file) {
+    return absl::UnavailableError(std::format("Could not write {}", path));
+  }
+  return absl::OkStatus();
+}
+
+std::vector<std::string> BudgetViolations(const DayBudget& budget,
+                                          const DayBudget& measured,
+                                          const BudgetTolerance& tolerance) {
+  std::vector<std::string> violations;
+  if (measured.part1 != budget.part1) {
+    violations.push_back(std::format("part 1 is {}, expected {}",
+                                     measured.part1, budget.part1));
+  }
+  if (measured.part2 != budget.part2) {
+    violations.push_back(std::format("part 2 is {}, expected {}",
+                                     measured.part2, budget.part2));
+  }
+  const double time_limit =
+      budget.time_ns + std::max(budget.time_ns * tolerance.time,
+                                tolerance.time_slack_ns);
+  if (measured.time_ns > time_limit) {
+    violations.push_back(std::format(
+        "took {}, budget {} (limit {})", FormatNanoseconds(measured.time_ns),
+        FormatNanoseconds(budget.time_ns), FormatNanoseconds(time_limit)));
+  }
+  const int64_t allocation_limit =
+      budget.allocations +
+      std::max(static_cast<int64_t>(budget.allocations * tolerance.allocations),
+               tolerance.allocation_slack);
+  if (measured.allocations > allocation_limit) {
+    violations.push_back(
+        std::format("made {} allocations, budget {} (limit {})",
+                    measured.allocations, budget.allocations,
+                    allocation_limit));
+  }
+  return violations;
+}
+
+}  // namespace aoc
@@ -0,0 +1,56 @@
+#pragma once
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+
+namespace aoc {
+
+// Known answers and resource budgets for the checked-in inputs, so that each
+// day's dayN_test (runner/day_test.cc) and //runner:aoc_runner --budgets can
+// fail when a day gets the wrong answer or gets slower or allocates more than
+// it used to.
+//
+// The budgets live in runner/budgets.json, keyed by DayName:
+//
+//   {
+//     "2015/day1": {"part1": "74", "part2": "1795", "time_ns": 41000,
+//                   "allocations": 0},
+//     ...
+//   }
+//
+// Times are machine-specific: refresh them with --update_budgets after
+// changing machines, not just after changing code.
+struct DayBudget {
+  std::string part1;
+  std::string part2;
+  // Parse, part 1 and part 2 together.
+  double time_ns = 0;
+  // Heap allocations made while the day ran, on any thread.
+  int64_t allocations = 0;
+};
+
+using Budgets = std::map<std::string, DayBudget>;
+
+absl::StatusOr<Budgets> ReadBudgets(const std::string& path);
+absl::Status WriteBudgets(const std::string& path, const Budgets& budgets);
+
+struct BudgetTolerance {
+  // How far over budget, as a fraction of the budget, counts as a regression.
+  double time = 0.5;
+  double allocations = 0.1;
+  // Overruns smaller than this are noise, however large a fraction they are.
+  double time_slack_ns = 1e6;
+  int64_t allocation_slack = 16;
+};
+
+// Everything `measured` gets wrong or goes over `budget` by, one line each.
+// Empty if it is within budget.
+std::vector<std::string> BudgetViolations(const DayBudget& budget,
+                                          const DayBudget& measured,
+                                          const BudgetTolerance& tolerance);
+
+}  // namespace aoc
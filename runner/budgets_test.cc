@@ -0,0 +1,123 @@
+#include "runner/budgets.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "gtest/gtest.h"
+
+namespace aoc {
+namespace {
+
+std::string TempPath(const std::string& name) {
+  const char* dir = std::getenv("TEST_TMPDIR");
+  return std::string(dir != nullptr ? dir : "/tmp") + "/" + name;
+}
+
+const DayBudget kBudget = {.part1 = "74",
+                           .part2 = "1795",
+                           .time_ns = 10e6,
+                           .allocations = 1000};
+
+TEST(BudgetViolationsTest, WithinBudget) {
+  EXPECT_TRUE(BudgetViolations(kBudget, kBudget, {}).empty());
+}
+
+TEST(BudgetViolationsTest, WrongAnswers) {
+  DayBudget measured = kBudget;
+  measured.part1 = "75";
+  measured.part2 = "1796";
+  EXPECT_EQ(BudgetViolations(kBudget, measured, {}),
+            (std::vector<std::string>{"part 1 is 75, expected 74",
+                                      "part 2 is 1796, expected 1795"}));
+}
+
+TEST(BudgetViolationsTest, TimeTolerance) {
+  const BudgetTolerance tolerance = {.time = 0.5, .time_slack_ns = 1e6};
+  DayBudget measured = kBudget;
+  measured.time_ns = 15e6;
+  EXPECT_TRUE(BudgetViolations(kBudget, measured, tolerance).empty());
+  measured.time_ns = 15.1e6;
+  EXPECT_EQ(BudgetViolations(kBudget, measured, tolerance).size(), 1);
+}
+
+TEST(BudgetViolationsTest, TimeSlackCoversFastDays) {
+  const BudgetTolerance tolerance = {.time = 0.5, .time_slack_ns = 1e6};
+  const DayBudget budget = {.time_ns = 1000};
+  DayBudget measured = budget;
+  measured.time_ns = 0.9e6;
+  EXPECT_TRUE(BudgetViolations(budget, measured, tolerance).empty());
+  measured.time_ns = 1.1e6;
+  EXPECT_EQ(BudgetViolations(budget, measured, tolerance).size(), 1);
+}
+
+TEST(BudgetViolationsTest, AllocationTolerance) {
+  const BudgetTolerance tolerance = {.allocations = 0.1,
+                                     .allocation_slack = 16};
+  DayBudget measured = kBudget;
+  measured.allocations = 1100;
+  EXPECT_TRUE(BudgetViolations(kBudget, measured, tolerance).empty());
+  measured.allocations = 1101;
+  EXPECT_EQ(BudgetViolations(kBudget, measured, tolerance),
+            (std::vector<std::string>{
+                "made 1101 allocations, budget 1000 (limit 1100)"}));
+}
+
+TEST(BudgetViolationsTest, AllocationSlackCoversSmallBudgets) {
+  const BudgetTolerance tolerance = {.allocations = 0.1,
+                                     .allocation_slack = 16};
+  const DayBudget budget = {.allocations = 0};
+  DayBudget measured = budget;
+  measured.allocations = 16;
+  EXPECT_TRUE(BudgetViolations(budget, measured, tolerance).empty());
+  measured.allocations = 17;
+  EXPECT_EQ(BudgetViolations(budget, measured, tolerance).size(), 1);
+}
+
+TEST(BudgetsFileTest, RoundTrips) {
+  const std::string path = TempPath("budgets_test.json");
+  const Budgets budgets = {
+      {"2015/day1", kBudget},
+      {"2024/day6", {.part1 = "4778", .part2 = "none", .time_ns = 2.5e9}},
+  };
+  ASSERT_TRUE(WriteBudgets(path, budgets).ok());
+
+  absl::StatusOr<Budgets> read = ReadBudgets(path);
+  ASSERT_TRUE(read.ok()) << read.status();
+  ASSERT_EQ(read->size(), 2);
+  const DayBudget& day1 = read->at("2015/day1");
+  EXPECT_EQ(day1.part1, "74");
+  EXPECT_EQ(day1.part2, "1795");
+  EXPECT_EQ(day1.time_ns, 10e6);
+  EXPECT_EQ(day1.allocations, 1000);
+  EXPECT_EQ(read->at("2024/day6").time_ns, 2.5e9);
+}
+
+TEST(BudgetsFileTest, MissingFileIsNotFound) {
+  EXPECT_TRUE(absl::IsNotFound(
+      ReadBudgets(TempPath("no_such_budgets.json")).status()));
+}
+
+TEST(BudgetsFileTest, BadJsonIsInvalidArgument) {
+  const std::string path = TempPath("bad_budgets.json");
+  std::ofstream(path) << "[1, 2";
+  EXPECT_TRUE(absl::IsInvalidArgument(ReadBudgets(path).status()));
+}
+
+TEST(BudgetsFileTest, MissingFieldsDefault) {
+  const std::string path = TempPath("partial_budgets.json");
+  std::ofstream(path) << R"({"2015/day4": {"part1": "282749"}})";
+  absl::StatusOr<Budgets> read = ReadBudgets(path);
+  ASSERT_TRUE(read.ok()) << read.status();
+  const DayBudget& day4 = read->at("2015/day4");
+  EXPECT_EQ(day4.part1, "282749");
+  EXPECT_EQ(day4.part2, "");
+  EXPECT_EQ(day4.time_ns, 0);
+  EXPECT_EQ(day4.allocations, 0);
+}
+
+}  // namespace
+}  // namespace aoc
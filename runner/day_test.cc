@@ -0,0 +1,91 @@
+// The test aoc_day_test() (utils/defs.bzl) builds for every day: solves each
+// day linked in on its own input and checks the answers, time and allocations
+// against runner/budgets.json (runner/budgets.h). It measures exactly what
+// //runner:aoc_runner --budgets does, so the two agree on every count.
+//
+// Times are only checked in optimized builds (bazel test -c opt //...), since
+// the budgets are recorded from one.
+
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "gtest/gtest.h"
+#include "runner/budgets.h"
+#include "utils/alloc_stats.h"
+#include "utils/day.h"
+#include "utils/thread_pool.h"
+
+namespace aoc {
+namespace {
+
+// Relative to the test's runfiles directory, like the days' own inputs.
+constexpr char kBudgetsPath[] = "runner/budgets.json";
+
+// Solve this many times and keep the fastest, as the runner does.
+constexpr int kRuns = 3;
+
+#ifdef NDEBUG
+constexpr bool kCheckTime = true;
+#else
+constexpr bool kCheckTime = false;
+#endif
+
+// Parses and solves the day's own input, counting allocations on every thread.
+DayBudget Solve(const RegisteredDay& registered, const DayInput& input) {
+  std::unique_ptr<Day> day = registered.make();
+  DayBudget measured;
+  AllocationCounter allocs(AllocScope::kProcess);
+  allocs.Start();
+  const auto start = std::chrono::steady_clock::now();
+  day->Parse(input.Contents());
+  measured.part1 = day->Part1();
+  measured.part2 = day->Part2();
+  measured.time_ns = std::chrono::duration<double, std::nano>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+  measured.allocations = allocs.Stop().allocations;
+  return measured;
+}
+
+TEST(DayTest, WithinBudget) {
+  absl::StatusOr<Budgets> budgets = ReadBudgets(kBudgetsPath);
+  ASSERT_TRUE(budgets.ok()) << budgets.status();
+  ASSERT_TRUE(AllocationTrackingAvailable());
+  // The runner starts the pool before measuring too.
+  DefaultThreadPool();
+
+  BudgetTolerance tolerance;
+  if (!kCheckTime) {
+    tolerance.time_slack_ns = std::numeric_limits<double>::infinity();
+  }
+  const std::vector<RegisteredDay> days = RegisteredDays();
+  ASSERT_FALSE(days.empty());
+  for (const RegisteredDay& registered : days) {
+    const std::string name = DayName(registered.info);
+    SCOPED_TRACE(name);
+    auto budget = budgets->find(name);
+    ASSERT_NE(budget, budgets->end())
+        << "No budget; run //runner:aoc_runner with --update_budgets";
+    absl::StatusOr<DayInput> input = DayInput::Open(registered.info);
+    ASSERT_TRUE(input.ok()) << input.status();
+    DayBudget measured = Solve(registered, *input);
+    for (int run = 1; run < kRuns; ++run) {
+      DayBudget rerun = Solve(registered, *input);
+      if (rerun.time_ns < measured.time_ns) {
+        measured = std::move(rerun);
+      }
+    }
+    for (const std::string& violation :
+         BudgetViolations(budget->second, measured, tolerance)) {
+      ADD_FAILURE() << violation;
+    }
+  }
+}
+
+}  // namespace
+}  // namespace aoc
@@ -0,0 +1,102 @@
+// Replaces the global operator new and delete so that AllocationCounter
+// (utils/alloc_stats.h) can see every heap allocation. Linking this file in
+// is the opt-in; see //utils:alloc_hooks.
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "utils/alloc_stats.h"
+
+namespace {
+
+[[maybe_unused]] const bool linked = [] {
+  aoc::alloc_internal::MarkHooksLinked();
+  return true;
+}();
+
+// malloc, or aligned_alloc for over-aligned types. aligned_alloc needs the size
+// to be a multiple of the alignment.
+void* RawAllocate(size_t size, size_t alignment) {
+  if (size == 0) size = 1;
+  if (alignment <= alignof(std::max_align_t)) return std::malloc(size);
+  return std::aligned_alloc(alignment,
+                            (size + alignment - 1) / alignment * alignment);
+}
+
+void* Allocate(size_t size, size_t alignment) {
+  while (true) {
+    void* ptr = RawAllocate(size, alignment);
+    if (ptr != nullptr) {
+      aoc::alloc_internal::RecordAlloc(ptr, size);
+      return ptr;
+    }
+    // Built without exceptions, so there is no bad_alloc to throw.
+    std::new_handler handler = std::get_new_handler();
+    if (handler == nullptr) std::abort();
+    handler();
+  }
+}
+
+void* AllocateNoThrow(size_t size, size_t alignment) {
+  void* ptr = RawAllocate(size, alignment);
+  aoc::alloc_internal::RecordAlloc(ptr, size);
+  return ptr;
+}
+
+void Free(void* ptr) {
+  aoc::alloc_internal::RecordFree(ptr);
+  std::free(ptr);
+}
+
+constexpr size_t kDefaultAlignment = alignof(std::max_align_t);
+
+}  // namespace
+
+void* operator new(size_t size) { return Allocate(size, kDefaultAlignment); }
+void* operator new[](size_t size) { return Allocate(size, kDefaultAlignment); }
+void* operator new(size_t size, std::align_val_t alignment) {
+  return Allocate(size, static_cast<size_t>(alignment));
+}
+void* operator new[](size_t size, std::align_val_t alignment) {
+  return Allocate(size, static_cast<size_t>(alignment));
+}
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  return AllocateNoThrow(size, kDefaultAlignment);
+}
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  return AllocateNoThrow(size, kDefaultAlignment);
+}
+void* operator new(size_t size, std::align_val_t alignment,
+                   const std::nothrow_t&) noexcept {
+  return AllocateNoThrow(size, static_cast<size_t>(alignment));
+}
+void* operator new[](size_t size, std::align_val_t alignment,
+                     const std::nothrow_t&) noexcept {
+  return AllocateNoThrow(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept { Free(ptr); }
+void operator delete[](void* ptr) noexcept { Free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { Free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { Free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { Free(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { Free(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept {
+  Free(ptr);
+}
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept {
+  Free(ptr);
+}
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { Free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+  Free(ptr);
+}
+void operator delete(void* ptr, std::align_val_t,
+                     const std::nothrow_t&) noexcept {
+  Free(ptr);
+}
+void operator delete[](void* ptr, std::align_val_t,
+                       const std::nothrow_t&) noexcept {
+  Free(ptr);
+}
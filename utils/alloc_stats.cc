@@ -0,0 +1,175 @@
+#include "utils/alloc_stats.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <print>
+#include <span>
+#include <string>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+namespace aoc {
+namespace {
+
+// Plain data so that it is safe to touch from operator new at any point in a
+// thread's life, including while thread_locals are being torn down.
+struct ThreadCounts {
+  int depth;
+  int64_t allocations;
+  int64_t frees;
+  int64_t bytes;
+  int64_t live_bytes;
+  int64_t peak_live_bytes;
+};
+
+constinit thread_local ThreadCounts counts = {};
+
+// The same for every thread, for AllocScope::kProcess counters.
+struct ProcessCounts {
+  std::atomic<int> depth;
+  std::atomic<int64_t> allocations;
+  std::atomic<int64_t> frees;
+  std::atomic<int64_t> bytes;
+  std::atomic<int64_t> live_bytes;
+  std::atomic<int64_t> peak_live_bytes;
+};
+
+constinit ProcessCounts process = {};
+
+std::atomic<bool> hooks_linked{false};
+
+int64_t UsableSize(void* ptr) {
+#if defined(__GLIBC__)
+  return malloc_usable_size(ptr);
+#else
+  return 0;
+#endif
+}
+
+std::string FormatBytes(int64_t bytes) {
+  if (bytes < 1024) return std::format("{} B", bytes);
+  if (bytes < 1024 * 1024) return std::format("{:.1f} KiB", bytes / 1024.0);
+  if (bytes < 1024 * 1024 * 1024) {
+    return std::format("{:.1f} MiB", bytes / (1024.0 * 1024));
+  }
+  return std::format("{:.1f} GiB", bytes / (1024.0 * 1024 * 1024));
+}
+
+}  // namespace
+
+namespace alloc_internal {
+
+void RecordAlloc(void* ptr, size_t size) {
+  if (ptr == nullptr) return;
+  const bool for_process = process.depth.load(std::memory_order_relaxed) > 0;
+  if (counts.depth == 0 && !for_process) return;
+  const int64_t usable = UsableSize(ptr);
+  if (counts.depth > 0) {
+    ++counts.allocations;
+    counts.bytes += size;
+    counts.live_bytes += usable;
+    counts.peak_live_bytes =
+        std::max(counts.peak_live_bytes, counts.live_bytes);
+  }
+  if (for_process) {
+    process.allocations.fetch_add(1, std::memory_order_relaxed);
+    process.bytes.fetch_add(size, std::memory_order_relaxed);
+    const int64_t live =
+        process.live_bytes.fetch_add(usable, std::memory_order_relaxed) +
+        usable;
+    int64_t peak = process.peak_live_bytes.load(std::memory_order_relaxed);
+    while (live > peak && !process.peak_live_bytes.compare_exchange_weak(
+                              peak, live, std::memory_order_relaxed)) {
+    }
+  }
+}
+
+void RecordFree(void* ptr) {
+  if (ptr == nullptr) return;
+  const bool for_process = process.depth.load(std::memory_order_relaxed) > 0;
+  if (counts.depth == 0 && !for_process) return;
+  const int64_t usable = UsableSize(ptr);
+  if (counts.depth > 0) {
+    ++counts.frees;
+    counts.live_bytes -= usable;
+  }
+  if (for_process) {
+    process.frees.fetch_add(1, std::memory_order_relaxed);
+    process.live_bytes.fetch_sub(usable, std::memory_order_relaxed);
+  }
+}
+
+void MarkHooksLinked() { hooks_linked.store(true, std::memory_order_relaxed); }
+
+}  // namespace alloc_internal
+
+bool AllocationTrackingAvailable() {
+  return hooks_linked.load(std::memory_order_relaxed);
+}
+
+void AllocationCounter::Start() {
+  if (scope_ == AllocScope::kProcess) {
+    constexpr auto kRelaxed = std::memory_order_relaxed;
+    start_ = {.allocations = process.allocations.load(kRelaxed),
+              .frees = process.frees.load(kRelaxed),
+              .bytes = process.bytes.load(kRelaxed)};
+    start_live_bytes_ = process.live_bytes.load(kRelaxed);
+    outer_peak_live_bytes_ =
+        process.peak_live_bytes.exchange(start_live_bytes_, kRelaxed);
+    process.depth.fetch_add(1, kRelaxed);
+    return;
+  }
+  start_ = {.allocations = counts.allocations,
+            .frees = counts.frees,
+            .bytes = counts.bytes};
+  start_live_bytes_ = counts.live_bytes;
+  // Track this counter's peak from here, and hand the outer one back on Stop.
+  outer_peak_live_bytes_ = counts.peak_live_bytes;
+  counts.peak_live_bytes = counts.live_bytes;
+  ++counts.depth;
+}
+
+AllocStats AllocationCounter::Stop() {
+  if (scope_ == AllocScope::kProcess) {
+    constexpr auto kRelaxed = std::memory_order_relaxed;
+    process.depth.fetch_sub(1, kRelaxed);
+    const int64_t peak = process.peak_live_bytes.load(kRelaxed);
+    AllocStats stats = {
+        .allocations = process.allocations.load(kRelaxed) - start_.allocations,
+        .frees = process.frees.load(kRelaxed) - start_.frees,
+        .bytes = process.bytes.load(kRelaxed) - start_.bytes,
+        .peak_live_bytes = peak - start_live_bytes_,
+    };
+    process.peak_live_bytes.store(std::max(outer_peak_live_bytes_, peak),
+                                  kRelaxed);
+    return stats;
+  }
+  --counts.depth;
+  AllocStats stats = {
+      .allocations = counts.allocations - start_.allocations,
+      .frees = counts.frees - start_.frees,
+      .bytes = counts.bytes - start_.bytes,
+      .peak_live_bytes = counts.peak_live_bytes - start_live_bytes_,
+  };
+  counts.peak_live_bytes =
+      std::max(outer_peak_live_bytes_, counts.peak_live_bytes);
+  return stats;
+}
+
+void PrintAllocTable(std::span<const AllocSample> samples) {
+  std::print("{:<16} {:>12} {:>12} {:>12} {:>12}\n", "phase", "allocs",
+             "frees", "bytes", "peak live");
+  for (const AllocSample& sample : samples) {
+    const AllocStats& s = sample.stats;
+    std::print("{:<16} {:>12} {:>12} {:>12} {:>12}\n", sample.name,
+               s.allocations, s.frees, FormatBytes(s.bytes),
+               FormatBytes(s.peak_live_bytes));
+  }
+}
+
+}  // namespace aoc
@@ -0,0 +1,83 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace aoc {
+
+// Heap allocation accounting for a region of code.
+//
+// Usage:
+//   aoc::AllocationCounter counter;
+//   counter.Start();
+//   FindJugCombinations(...);
+//   aoc::AllocStats stats = counter.Stop();
+//
+// Counting needs the replacement operator new/delete in //utils:alloc_hooks,
+// which aoc_day() binaries and //runner:aoc_runner link under
+// --config=alloc; RunDay's --alloc flag prints a report per phase. Without the
+// hooks every count stays zero.
+//
+// By default only allocations made on the calling thread are counted, so work
+// handed to a thread pool is not included. An AllocScope::kProcess counter
+// counts every thread's.
+struct AllocStats {
+  int64_t allocations = 0;
+  int64_t frees = 0;
+  // Bytes requested from operator new.
+  int64_t bytes = 0;
+  // Most heap memory held at once, beyond what was held at Start(). Counts
+  // what the allocator actually reserved, which may exceed what was asked.
+  int64_t peak_live_bytes = 0;
+};
+
+// True if //utils:alloc_hooks is linked into the binary.
+bool AllocationTrackingAvailable();
+
+enum class AllocScope {
+  // Allocations made on the thread that called Start().
+  kThread,
+  // Allocations made on any thread. Process counters running at the same time
+  // see each other's allocations, so only one region should be measured at a
+  // time.
+  kProcess,
+};
+
+class AllocationCounter {
+ public:
+  explicit AllocationCounter(AllocScope scope = AllocScope::kThread)
+      : scope_(scope) {}
+
+  // Starts counting. Counters may be nested.
+  void Start();
+  // Stops counting and returns what happened since Start(). A kThread counter
+  // must be stopped on the thread that started it.
+  AllocStats Stop();
+
+ private:
+  AllocScope scope_;
+  AllocStats start_;
+  int64_t start_live_bytes_ = 0;
+  int64_t outer_peak_live_bytes_ = 0;
+};
+
+// Stats for one named phase of a run.
+struct AllocSample {
+  std::string name;
+  AllocStats stats;
+};
+
+// Prints one row per sample: allocations, frees, bytes and peak live bytes.
+void PrintAllocTable(std::span<const AllocSample> samples);
+
+namespace alloc_internal {
+
+// Called by the replacement operators in alloc_hooks.cc.
+void RecordAlloc(void* ptr, size_t size);
+void RecordFree(void* ptr);
+void MarkHooksLinked();
+
+}  // namespace alloc_internal
+
+}  // namespace aoc
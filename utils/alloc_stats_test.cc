@@ -0,0 +1,86 @@
+#include "utils/alloc_stats.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace aoc {
+namespace {
+
+// Makes `count` allocations of `size` bytes each, all freed by the end.
+void Allocate(int count, int size) {
+  std::vector<std::unique_ptr<char[]>> blocks;
+  blocks.reserve(count);
+  for (int i = 0; i < count; ++i) {
+    blocks.push_back(std::make_unique<char[]>(size));
+  }
+}
+
+TEST(AllocStatsTest, HooksAreLinked) {
+  EXPECT_TRUE(AllocationTrackingAvailable());
+}
+
+TEST(AllocStatsTest, CountsThisThread) {
+  AllocationCounter counter;
+  counter.Start();
+  Allocate(10, 1000);
+  AllocStats stats = counter.Stop();
+  // The vector's own buffer is one more.
+  EXPECT_EQ(stats.allocations, 11);
+  EXPECT_EQ(stats.frees, 11);
+  EXPECT_GE(stats.bytes, 10 * 1000);
+  EXPECT_GE(stats.peak_live_bytes, 10 * 1000);
+}
+
+TEST(AllocStatsTest, ThreadScopeMissesOtherThreads) {
+  AllocationCounter counter(AllocScope::kThread);
+  counter.Start();
+  std::thread([] { Allocate(10, 1000); }).join();
+  AllocStats stats = counter.Stop();
+  EXPECT_LT(stats.allocations, 10);
+}
+
+TEST(AllocStatsTest, ProcessScopeCountsOtherThreads) {
+  AllocationCounter counter(AllocScope::kProcess);
+  counter.Start();
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([] { Allocate(10, 1000); });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  AllocStats stats = counter.Stop();
+  EXPECT_GE(stats.allocations, 4 * 11);
+  EXPECT_GE(stats.bytes, 4 * 10 * 1000);
+  EXPECT_GE(stats.peak_live_bytes, 10 * 1000);
+}
+
+TEST(AllocStatsTest, NestedCountersSeeTheirOwnRegions) {
+  AllocationCounter outer;
+  AllocationCounter inner;
+  outer.Start();
+  Allocate(5, 100);
+  inner.Start();
+  Allocate(3, 100);
+  AllocStats inner_stats = inner.Stop();
+  AllocStats outer_stats = outer.Stop();
+  EXPECT_EQ(inner_stats.allocations, 4);
+  EXPECT_EQ(outer_stats.allocations, 10);
+}
+
+TEST(AllocStatsTest, NothingCountedWhenStopped) {
+  AllocationCounter counter;
+  counter.Start();
+  AllocStats first = counter.Stop();
+  Allocate(10, 1000);
+  counter.Start();
+  AllocStats second = counter.Stop();
+  EXPECT_EQ(first.allocations, 0);
+  EXPECT_EQ(second.allocations, 0);
+}
+
+}  // namespace
+}  // namespace aoc
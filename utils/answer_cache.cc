@@ -0,0 +1,128 @@
+#include "utils/answer_cache.h"
+
+#include <openssl/sha.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+
+namespace aoc {
+namespace {
+
+// "2015/day7 (alternate)" -> "2015/day7-alternate".
+std::string DayDirectory(std::string_view day) {
+  std::string dir;
+  for (char c : day) {
+    if (std::isalnum(static_cast<unsigned char>(c)) || c == '/' || c == '_') {
+      dir += c;
+    } else if (c != '(' && c != ')') {
+      dir += '-';
+    }
+  }
+  return dir;
+}
+
+// Creates `dir` and any missing parents, like `mkdir -p`.
+absl::Status MakeDirectories(const std::string& dir) {
+  for (size_t end = dir.find('/', 1);; end = dir.find('/', end + 1)) {
+    const std::string prefix = dir.substr(0, end);
+    if (::mkdir(prefix.c_str(), 0755) != 0 && errno != EEXIST) {
+      return absl::UnavailableError(std::format("Could not create {}: {}",
+                                                prefix, std::strerror(errno)));
+    }
+    if (end == std::string::npos) {
+      break;
+    }
+  }
+  struct stat dir_stat;
+  if (::stat(dir.c_str(), &dir_stat) != 0 || !S_ISDIR(dir_stat.st_mode)) {
+    return absl::UnavailableError(
+        std::format("Could not create {}: not a directory", dir));
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace
+
+std::string HashInput(std::string_view input) {
+  unsigned char digest[SHA256_DIGEST_LENGTH];
+  SHA256(reinterpret_cast<const unsigned char*>(input.data()), input.size(),
+         digest);
+  std::string hex;
+  for (unsigned char byte : digest) {
+    hex += std::format("{:02x}", byte);
+  }
+  return hex;
+}
+
+std::string DefaultAnswerCacheDir() {
+  if (const char* xdg = std::getenv("XDG_CACHE_HOME"); xdg && *xdg) {
+    return std::format("{}/aoc/answers", xdg);
+  }
+  if (const char* home = std::getenv("HOME"); home && *home) {
+    return std::format("{}/.cache/aoc/answers", home);
+  }
+  return "";
+}
+
+std::string AnswerCache::PathFor(const AnswerKey& key) const {
+  return std::format("{}/{}/part{}-v{}-{}", dir_, DayDirectory(key.day),
+                     key.part, key.version, key.input_hash);
+}
+
+absl::StatusOr<std::optional<std::string>> AnswerCache::Lookup(
+    const AnswerKey& key) const {
+  const std::string path = PathFor(key);
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    struct stat file_stat;
+    if (::stat(path.c_str(), &file_stat) != 0 && errno == ENOENT) {
+      return std::nullopt;
+    }
+    return absl::UnavailableError(std::format("Could not read {}", path));
+  }
+  return std::string((std::istreambuf_iterator<char>(file)),
+                     std::istreambuf_iterator<char>());
+}
+
+absl::Status AnswerCache::Store(const AnswerKey& key,
+                                std::string_view answer) const {
+  const std::string path = PathFor(key);
+  if (absl::Status status = MakeDirectories(path.substr(0, path.rfind('/')));
+      !status.ok()) {
+    return status;
+  }
+  // Write to a private file and rename it into place, so that a reader never
+  // sees half an answer.
+  const std::string temp = std::format("{}.tmp{}", path, ::getpid());
+  {
+    std::ofstream file(temp, std::ios::binary);
+    file << answer;
+    if (!file) {
+      return absl::UnavailableError(std::format("Could not write {}", temp));
+    }
+  }
+  if (::rename(temp.c_str(), path.c_str()) != 0) {
+    const int error = errno;
+    ::unlink(temp.c_str());
+    return absl::UnavailableError(
+        std::format("Could not write {}: {}", path, std::strerror(error)));
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace aoc
@@ -0,0 +1,59 @@
+#pragma once
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+
+namespace aoc {
+
+// An on-disk cache of answers, keyed by what produced them: the day, the
+// part, the solver's version and a SHA-256 of the input bytes. A cached
+// answer can only be stale if the solver changed without its version being
+// bumped, which is why RunDay only uses the cache with --answer_cache=on.
+//
+// Usage:
+//   aoc::AnswerCache cache("/home/me/.cache/aoc/answers");
+//   aoc::AnswerKey key = {.day = "2015/day4", .part = 1, .version = 0,
+//                         .input_hash = aoc::HashInput(input)};
+//   absl::StatusOr<std::optional<std::string>> answer = cache.Lookup(key);
+//
+// Each answer is its own small file, written atomically, so concurrent runs
+// can share a directory.
+struct AnswerKey {
+  // DayName(), e.g. "2015/day7 (alternate)".
+  std::string day;
+  int part = 0;
+  // DayInfo::version.
+  int version = 0;
+  // HashInput() of the input that was solved.
+  std::string input_hash;
+};
+
+// Hex SHA-256 of `input`.
+std::string HashInput(std::string_view input);
+
+// $XDG_CACHE_HOME/aoc/answers, else $HOME/.cache/aoc/answers. Empty if
+// neither is set.
+std::string DefaultAnswerCacheDir();
+
+class AnswerCache {
+ public:
+  explicit AnswerCache(std::string dir) : dir_(std::move(dir)) {}
+
+  // The cached answer for `key`, or nullopt on a miss.
+  absl::StatusOr<std::optional<std::string>> Lookup(
+      const AnswerKey& key) const;
+
+  // Stores `answer` for `key`, replacing any previous answer.
+  absl::Status Store(const AnswerKey& key, std::string_view answer) const;
+
+ private:
+  std::string PathFor(const AnswerKey& key) const;
+
+  std::string dir_;
+};
+
+}  // namespace aoc
@@ -0,0 +1,38 @@
+#include "utils/arena.h"
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+namespace aoc {
+
+Arena::Arena(size_t initial_size) : block_size_(initial_size) { NewBlock(); }
+
+void Arena::Reset() {
+  if (overflow_.bytes() == 0) {
+    resource_->release();
+    return;
+  }
+  // The last solve didn't fit. Grow the block so the next one will.
+  block_size_ += overflow_.bytes();
+  NewBlock();
+}
+
+void Arena::NewBlock() {
+  // The old resource has to go before the block (and overflow) it points at.
+  resource_.reset();
+  overflow_.clear();
+  block_ = std::make_unique_for_overwrite<std::byte[]>(block_size_);
+  resource_.emplace(block_.get(), block_size_, &overflow_);
+}
+
+void* Arena::Overflow::do_allocate(size_t bytes, size_t alignment) {
+  bytes_ += bytes;
+  return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+}
+
+void Arena::Overflow::do_deallocate(void* p, size_t bytes, size_t alignment) {
+  std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+}
+
+}  // namespace aoc
@@ -0,0 +1,82 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+namespace aoc {
+
+// Scratch memory for a single solve.
+//
+// Allocations are bump-pointer carved out of a monotonic buffer and are never
+// freed individually; Reset() (or destroying the Arena) releases all of them
+// at once. Reset() keeps one block big enough for everything that was
+// allocated since the last reset, so repeated solves of the same input hit
+// malloc only on the first pass.
+//
+// Any std::pmr container can allocate from it:
+//   aoc::Arena arena;
+//   {
+//     std::pmr::vector<std::pmr::string> lines =
+//         aoc::LoadStringsFromFileByLine("./2015/day5.txt", arena.resource());
+//     ...
+//   }
+//   arena.Reset();
+//
+// Everything allocated from the arena must be destroyed before Reset(), since
+// destructors still read the memory being released.
+//
+// Copy-constructing a std::pmr container does NOT propagate the resource: the
+// copy goes to the heap. Pass the resource explicitly instead, e.g.
+//   std::pmr::vector<int> copy(v, arena.resource());
+//
+// An arena suits memory that lives for the whole solve. Deep searches that
+// copy and drop state at every node are usually better off on the heap, since
+// nothing is reused until the arena is reset.
+//
+// Not thread-safe.
+class Arena {
+ public:
+  static constexpr size_t kDefaultInitialSize = 64 << 10;
+
+  explicit Arena(size_t initial_size = kDefaultInitialSize);
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+
+  std::pmr::memory_resource* resource() { return &*resource_; }
+  std::pmr::polymorphic_allocator<> allocator() { return &*resource_; }
+
+  // Releases everything allocated from the arena.
+  void Reset();
+
+  // Size of the block the arena starts from after a Reset().
+  size_t BlockSize() const { return block_size_; }
+
+ private:
+  // Forwards to the heap, counting how much the arena had to ask for beyond
+  // its first block.
+  class Overflow : public std::pmr::memory_resource {
+   public:
+    size_t bytes() const { return bytes_; }
+    void clear() { bytes_ = 0; }
+
+   private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const memory_resource& other) const noexcept override {
+      return this == &other;
+    }
+
+    size_t bytes_ = 0;
+  };
+
+  // (Re)creates resource_ on top of a fresh block of block_size_ bytes.
+  void NewBlock();
+
+  size_t block_size_;
+  std::unique_ptr<std::byte[]> block_;
+  Overflow overflow_;
+  std::optional<std::pmr::monotonic_buffer_resource> resource_;
+};
+
+}  // namespace aoc
@@ -0,0 +1,105 @@
+// Compares parsing an input with heap-allocated strings against the pmr
+// overloads backed by an aoc::Arena that is reset between solves.
+//
+// Usage: bazel run -c opt //utils:arena_benchmark -- [input_file]
+
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <memory_resource>
+#include <print>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "utils/arena.h"
+#include "utils/utils.h"
+
+namespace {
+
+constexpr int kRepetitions = 200;
+
+// Keeps the optimizer from throwing away the parsed tokens.
+size_t sink = 0;
+
+template <typename F>
+double TimeUsPerSolve(F solve) {
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kRepetitions; ++i) {
+    solve();
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() /
+         kRepetitions;
+}
+
+// A stand-in input shaped like most AoC days: a few thousand short lines of
+// space separated tokens.
+std::string SyntheticInput() {
+  std::string input;
+  for (int line = 0; line < 5000; ++line) {
+    std::format_to(std::back_inserter(input),
+                   "Comet can fly {} km/s for {} seconds, but then must rest "
+                   "for {} seconds.\n",
+                   line % 97, line % 13, line % 251);
+  }
+  return input;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::string input =
+      argc > 1 ? aoc::ReadFileToString(argv[1]) : SyntheticInput();
+
+  // Lines + split: what a solve's parsing costs end to end.
+  double heap_us = TimeUsPerSolve([&] {
+    std::vector<std::string> lines = aoc::SplitLines(input);
+    for (const std::string& line : lines) {
+      std::vector<std::string> tokens = aoc::SplitDelimitedString(line);
+      sink += tokens.size();
+    }
+  });
+
+  aoc::Arena arena;
+  double arena_us = TimeUsPerSolve([&] {
+    {
+      std::pmr::vector<std::pmr::string> lines =
+          aoc::SplitLines(input, arena.resource());
+      for (const std::pmr::string& line : lines) {
+        std::pmr::vector<std::pmr::string> tokens =
+            aoc::SplitDelimitedString(line, "", arena.resource());
+        sink += tokens.size();
+      }
+    }
+    arena.Reset();
+  });
+
+  // Split only, with the lines already built, so allocation is most of the
+  // work.
+  std::vector<std::string> lines = aoc::SplitLines(input);
+  double heap_split_us = TimeUsPerSolve([&] {
+    for (const std::string& line : lines) {
+      std::vector<std::string> tokens = aoc::SplitDelimitedString(line);
+      sink += tokens.size();
+    }
+  });
+  double arena_split_us = TimeUsPerSolve([&] {
+    for (const std::string& line : lines) {
+      std::pmr::vector<std::pmr::string> tokens =
+          aoc::SplitDelimitedString(line, "", arena.resource());
+      sink += tokens.size();
+    }
+    arena.Reset();
+  });
+
+  std::print("{:<12} {:>10} {:>10} {:>8}\n", "", "heap us", "arena us",
+             "speedup");
+  std::print("{:<12} {:>10.1f} {:>10.1f} {:>7.2f}x\n", "lines+split", heap_us,
+             arena_us, heap_us / arena_us);
+  std::print("{:<12} {:>10.1f} {:>10.1f} {:>7.2f}x\n", "split", heap_split_us,
+             arena_split_us, heap_split_us / arena_split_us);
+  std::print("Arena block after warm-up: {} KiB\n", arena.BlockSize() >> 10);
+  return sink == 42 ? 1 : 0;
+}
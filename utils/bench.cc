@@ -0,0 +1,114 @@
+#include "utils/bench.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <numeric>
+#include <print>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace aoc {
+namespace {
+
+// Nearest-rank percentile of sorted samples.
+double Percentile(const std::vector<double>& sorted, double percent) {
+  size_t rank = static_cast<size_t>(std::ceil(percent / 100 * sorted.size()));
+  return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+
+std::string FormatRate(double per_second) {
+  if (per_second == 0) return "";
+  if (per_second < 1e3) return std::format("{:.1f}/s", per_second);
+  if (per_second < 1e6) return std::format("{:.1f}k/s", per_second / 1e3);
+  if (per_second < 1e9) return std::format("{:.1f}M/s", per_second / 1e6);
+  return std::format("{:.1f}G/s", per_second / 1e9);
+}
+
+}  // namespace
+
+std::string FormatNanoseconds(double ns) {
+  if (ns < 1e3) return std::format("{:.0f} ns", ns);
+  if (ns < 1e6) return std::format("{:.2f} us", ns / 1e3);
+  if (ns < 1e9) return std::format("{:.2f} ms", ns / 1e6);
+  return std::format("{:.2f} s", ns / 1e9);
+}
+
+std::string JsonEscape(std::string_view str) {
+  std::string escaped;
+  for (char c : str) {
+    switch (c) {
+      case '"':
+        escaped += "\\\"";
+        break;
+      case '\\':
+        escaped += "\\\\";
+        break;
+      case '\n':
+        escaped += "\\n";
+        break;
+      default:
+        escaped += c;
+    }
+  }
+  return escaped;
+}
+
+double BenchResult::ItemsPerSecond() const {
+  if (items_per_run == 0 || median_ns == 0) return 0;
+  return items_per_run * 1e9 / median_ns;
+}
+
+BenchResult SummarizeBenchSamples(std::string name,
+                                  std::vector<double> samples_ns,
+                                  int64_t items_per_run) {
+  BenchResult result{.name = std::move(name), .items_per_run = items_per_run};
+  if (samples_ns.empty()) {
+    return result;
+  }
+  std::sort(samples_ns.begin(), samples_ns.end());
+  result.runs = samples_ns.size();
+  result.min_ns = samples_ns.front();
+  result.max_ns = samples_ns.back();
+  result.median_ns = Percentile(samples_ns, 50);
+  result.p99_ns = Percentile(samples_ns, 99);
+  result.mean_ns =
+      std::accumulate(samples_ns.begin(), samples_ns.end(), 0.0) /
+      samples_ns.size();
+  return result;
+}
+
+void PrintBenchTable(std::span<const BenchResult> results) {
+  std::print("{:<16} {:>8} {:>11} {:>11} {:>11} {:>11}\n", "benchmark", "runs",
+             "min", "median", "p99", "throughput");
+  for (const BenchResult& result : results) {
+    std::print("{:<16} {:>8} {:>11} {:>11} {:>11} {:>11}\n", result.name,
+               result.runs, FormatNanoseconds(result.min_ns),
+               FormatNanoseconds(result.median_ns),
+               FormatNanoseconds(result.p99_ns),
+               FormatRate(result.ItemsPerSecond()));
+  }
+}
+
+std::string BenchResultsToJson(std::span<const BenchResult> results) {
+  std::string json = "[\n";
+  for (size_t i = 0; i < results.size(); ++i) {
+    const BenchResult& r = results[i];
+    json += std::format(
+        "  {{\"name\": \"{}\", \"runs\": {}, \"min_ns\": {:.1f}, "
+        "\"median_ns\": {:.1f}, \"mean_ns\": {:.1f}, \"p99_ns\": {:.1f}, "
+        "\"max_ns\": {:.1f}, \"items_per_run\": {}, "
+        "\"items_per_second\": {:.1f}}}{}\n",
+        JsonEscape(r.name), r.runs, r.min_ns, r.median_ns, r.mean_ns,
+        r.p99_ns, r.max_ns, r.items_per_run, r.ItemsPerSecond(),
+        i + 1 < results.size() ? "," : "");
+  }
+  json += "]\n";
+  return json;
+}
+
+}  // namespace aoc
@@ -0,0 +1,105 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace aoc {
+
+// A small, dependency-free micro-benchmark harness.
+//
+// Usage:
+//   std::vector<aoc::BenchResult> results = {
+//       aoc::Bench("part1", [&] { return Part1(input); }),
+//   };
+//   aoc::PrintBenchTable(results);
+//
+// Each benchmark runs `warmup_runs` untimed iterations, then times single
+// iterations until it has at least `min_runs` samples and has spent at least
+// `min_seconds`, or has hit `max_runs`.
+struct BenchOptions {
+  int warmup_runs = 3;
+  int min_runs = 10;
+  int max_runs = 100000;
+  double min_seconds = 0.5;
+  // Work items processed per run (lines, cells, nonces...). When set, results
+  // report throughput.
+  int64_t items_per_run = 0;
+};
+
+struct BenchResult {
+  std::string name;
+  int64_t runs = 0;
+  double min_ns = 0;
+  double median_ns = 0;
+  double mean_ns = 0;
+  double p99_ns = 0;
+  double max_ns = 0;
+  int64_t items_per_run = 0;
+
+  // Items per second at the median run time, or 0 if items_per_run is unset.
+  double ItemsPerSecond() const;
+};
+
+// Keeps the compiler from optimizing away a value that is otherwise unused.
+template <typename T>
+inline void DoNotOptimize(const T& value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Builds a BenchResult from raw per-run samples, in nanoseconds.
+BenchResult SummarizeBenchSamples(std::string name,
+                                  std::vector<double> samples_ns,
+                                  int64_t items_per_run);
+
+template <typename F>
+BenchResult Bench(std::string name, F&& fn, const BenchOptions& options = {}) {
+  using Clock = std::chrono::steady_clock;
+  auto run_once = [&fn] {
+    if constexpr (std::is_void_v<std::invoke_result_t<F&>>) {
+      fn();
+    } else {
+      auto result = fn();
+      DoNotOptimize(result);
+    }
+  };
+
+  for (int i = 0; i < options.warmup_runs; ++i) {
+    run_once();
+  }
+
+  std::vector<double> samples_ns;
+  samples_ns.reserve(options.min_runs);
+  const Clock::time_point deadline =
+      Clock::now() + std::chrono::duration_cast<Clock::duration>(
+                         std::chrono::duration<double>(options.min_seconds));
+  while (samples_ns.size() < options.max_runs &&
+         (samples_ns.size() < options.min_runs || Clock::now() < deadline)) {
+    Clock::time_point start = Clock::now();
+    run_once();
+    Clock::time_point end = Clock::now();
+    samples_ns.push_back(
+        std::chrono::duration<double, std::nano>(end - start).count());
+  }
+  return SummarizeBenchSamples(std::move(name), std::move(samples_ns),
+                               options.items_per_run);
+}
+
+// Formats a duration with a unit that keeps it readable, e.g. "1.25 ms".
+std::string FormatNanoseconds(double ns);
+
+// Escapes `str` for use inside a JSON string literal.
+std::string JsonEscape(std::string_view str);
+
+// Prints one row per result: runs, min, median, p99 and throughput.
+void PrintBenchTable(std::span<const BenchResult> results);
+
+// Serializes results as a JSON array of objects, one per result, with every
+// BenchResult field plus "items_per_second".
+std::string BenchResultsToJson(std::span<const BenchResult> results);
+
+}  // namespace aoc
@@ -0,0 +1,65 @@
+#include "utils/coord_set.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "utils/utils.h"
+
+namespace aoc {
+
+CoordSet::CoordSet(int64_t rows, int64_t cols)
+    : rows_(rows), cols_(cols), bits_((rows * cols + 63) / 64, 0) {}
+
+bool CoordSet::Insert(Coordinate c) {
+  if (!InBitmap(c)) {
+    bool inserted = overflow_.insert(CoordKey::From(c)).second;
+    size_ += inserted;
+    return inserted;
+  }
+  size_t index = BitIndex(c);
+  uint64_t mask = uint64_t{1} << (index % 64);
+  uint64_t& word = bits_[index / 64];
+  if (word & mask) {
+    return false;
+  }
+  word |= mask;
+  ++size_;
+  return true;
+}
+
+bool CoordSet::Erase(Coordinate c) {
+  if (!InBitmap(c)) {
+    bool erased = overflow_.erase(CoordKey::From(c)) > 0;
+    size_ -= erased;
+    return erased;
+  }
+  size_t index = BitIndex(c);
+  uint64_t mask = uint64_t{1} << (index % 64);
+  uint64_t& word = bits_[index / 64];
+  if (!(word & mask)) {
+    return false;
+  }
+  word &= ~mask;
+  --size_;
+  return true;
+}
+
+bool CoordSet::Contains(Coordinate c) const {
+  if (!InBitmap(c)) {
+    return overflow_.contains(CoordKey::From(c));
+  }
+  size_t index = BitIndex(c);
+  return (bits_[index / 64] >> (index % 64)) & 1;
+}
+
+void CoordSet::Clear() {
+  if (size_ == 0) {
+    return;
+  }
+  std::fill(bits_.begin(), bits_.end(), 0);
+  overflow_.clear();
+  size_ = 0;
+}
+
+}  // namespace aoc
@@ -0,0 +1,57 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "absl/container/flat_hash_set.h"
+#include "utils/utils.h"
+
+namespace aoc {
+
+// A set of grid coordinates.
+//
+// When constructed with grid bounds, every in-bounds coordinate is a single bit
+// in a dense bitmap, so Insert() and Contains() are a shift and a mask with no
+// hashing at all. Coordinates outside the bounds (and every coordinate when no
+// bounds are given) fall back to a hash set of packed CoordKeys.
+//
+// Usage:
+//   aoc::CoordSet antinodes(map.NumRows(), map.NumCols());
+//   antinodes.Insert(c);
+//   std::print("{}\n", antinodes.Size());
+class CoordSet {
+ public:
+  // Unbounded: everything is hashed.
+  CoordSet() = default;
+
+  // Bounded: coordinates in [0, rows) x [0, cols) live in the bitmap.
+  CoordSet(int64_t rows, int64_t cols);
+
+  // Returns true if `c` was not already in the set.
+  bool Insert(Coordinate c);
+
+  // Returns true if `c` was in the set.
+  bool Erase(Coordinate c);
+
+  bool Contains(Coordinate c) const;
+
+  size_t Size() const { return size_; }
+  bool Empty() const { return size_ == 0; }
+
+  // Removes every coordinate. The bitmap keeps its allocation.
+  void Clear();
+
+ private:
+  bool InBitmap(Coordinate c) const {
+    return c.row >= 0 && c.row < rows_ && c.col >= 0 && c.col < cols_;
+  }
+  size_t BitIndex(Coordinate c) const { return c.row * cols_ + c.col; }
+
+  int64_t rows_ = 0;
+  int64_t cols_ = 0;
+  std::vector<uint64_t> bits_;
+  absl::flat_hash_set<CoordKey, CoordKeyHash> overflow_;
+  size_t size_ = 0;
+};
+
+}  // namespace aoc
@@ -0,0 +1,514 @@
+#include "utils/day.h"
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <print>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "utils/alloc_stats.h"
+#include "utils/answer_cache.h"
+#include "utils/bench.h"
+#include "utils/embedded_input.h"
+#include "utils/line_stream.h"
+#include "utils/mapped_input.h"
+#include "utils/perf_counters.h"
+#include "utils/thread_pool.h"
+#include "utils/trace.h"
+
+ABSL_FLAG(std::string, input, "",
+          "Solve this file instead of the day's checked-in input.");
+ABSL_FLAG(bool, bench, false,
+          "Time Parse, Part1 and Part2 and print a table of the results.");
+ABSL_FLAG(std::string, bench_json, "",
+          "With --bench, also write the timings to this file as JSON.");
+ABSL_FLAG(bool, alloc, false,
+          "Count heap allocations, bytes and peak live bytes for Parse, Part1 "
+          "and Part2 and print a table of the results.");
+ABSL_FLAG(bool, perf, false,
+          "Count cycles, instructions, cache misses and branch misses for "
+          "Parse, Part1 and Part2 and print a table of the results.");
+ABSL_FLAG(std::string, answer_cache, "off",
+          "off: always solve. on: reuse answers cached for the same day, "
+          "version and input. verify: solve and check against the cache.");
+ABSL_FLAG(std::string, answer_cache_dir, "",
+          "Where to cache answers. Defaults to $XDG_CACHE_HOME/aoc/answers or "
+          "~/.cache/aoc/answers.");
+ABSL_FLAG(bool, stream, false,
+          "Read the input a line at a time instead of all at once, for inputs "
+          "bigger than memory. Only for days whose Parse takes a LineStream.");
+ABSL_FLAG(bool, batch_parallel, true,
+          "When given several inputs, solve them concurrently on the default "
+          "thread pool.");
+
+namespace aoc {
+namespace {
+
+// Filled in by static initializers, so it must be constructed on first use.
+std::vector<RegisteredDay>& Registry() {
+  static auto* registry = new std::vector<RegisteredDay>();
+  return *registry;
+}
+
+}  // namespace
+
+std::string DayName(const DayInfo& info) {
+  std::string name = std::format("{}/day{}", info.year, info.day);
+  if (!info.variant.empty()) {
+    name += std::format(" ({})", info.variant);
+  }
+  return name;
+}
+
+absl::StatusOr<DayInput> DayInput::Open(const DayInfo& info,
+                                        std::string_view path) {
+  // `path`, else the checked-in file (embedded in the binary if aoc_day() did
+  // that, otherwise read from disk), else the literal in the source.
+  DayInput input;
+  if (path.empty()) {
+    std::optional<std::string_view> embedded =
+        FindEmbeddedInput(info.input_file);
+    if (embedded.has_value()) {
+      input.literal_ = *embedded;
+      return input;
+    }
+    path = info.input_file;
+  }
+  if (path.empty()) {
+    input.literal_ = info.input_literal;
+    return input;
+  }
+  absl::StatusOr<MappedInput> file = MappedInput::Open(std::string(path));
+  if (!file.ok()) {
+    return file.status();
+  }
+  input.file_.emplace(std::move(*file));
+  return input;
+}
+
+bool RegisterDay(RegisteredDay day) {
+  Registry().push_back(std::move(day));
+  return true;
+}
+
+std::vector<RegisteredDay> RegisteredDays() {
+  std::vector<RegisteredDay> days = Registry();
+  std::sort(days.begin(), days.end(),
+            [](const RegisteredDay& a, const RegisteredDay& b) {
+              return std::tie(a.info.year, a.info.day, a.info.variant) <
+                     std::tie(b.info.year, b.info.day, b.info.variant);
+            });
+  return days;
+}
+
+namespace {
+
+// Solves one input: the day's own, or --input.
+int RunSingle(Day& day) {
+  const DayInfo& info = day.info();
+  const std::string name = DayName(info);
+
+  const std::string trace_path = absl::GetFlag(FLAGS_trace_json);
+  if (!trace_path.empty()) {
+    StartTracing();
+  }
+  const bool count_perf = absl::GetFlag(FLAGS_perf);
+  PerfCounters perf = count_perf ? PerfCounters::Open() : PerfCounters();
+  std::vector<PerfSample> perf_samples;
+  const bool count_allocs = absl::GetFlag(FLAGS_alloc);
+  std::vector<AllocSample> alloc_samples;
+  const bool stream = absl::GetFlag(FLAGS_stream);
+  if (stream && absl::GetFlag(FLAGS_bench)) {
+    std::print(stderr, "--bench reparses the input, so it can't --stream.\n");
+    return 1;
+  }
+
+  const std::string cache_mode = absl::GetFlag(FLAGS_answer_cache);
+  if (cache_mode != "on" && cache_mode != "off" && cache_mode != "verify") {
+    std::print(stderr, "--answer_cache must be on, off or verify, not {}\n",
+               cache_mode);
+    return 1;
+  }
+  std::string cache_dir = absl::GetFlag(FLAGS_answer_cache_dir);
+  if (cache_dir.empty()) {
+    cache_dir = DefaultAnswerCacheDir();
+  }
+  // The cache would skip the very work the measuring flags are asking about,
+  // and hashing a streamed input would mean reading all of it first.
+  const bool use_cache = cache_mode != "off" && !cache_dir.empty() &&
+                         !absl::GetFlag(FLAGS_bench) && !count_perf &&
+                         !count_allocs && !stream;
+  const AnswerCache cache(cache_dir);
+  // Cache problems are never fatal; the day just gets solved.
+  auto warn = [](const absl::Status& status) {
+    std::print(stderr, "Answer cache: {}\n", status.ToString());
+  };
+
+  absl::StatusOr<DayInput> day_input;
+  std::string_view input;
+  // Set with --stream. It reads --input itself, or else day_input.
+  std::optional<LineStream> lines;
+  bool verify_failed = false;
+  {
+    ScopedTimer day_timer(name);
+    absl::Status read;
+    {
+      AOC_SCOPED_TIMER("read");
+      const std::string path = absl::GetFlag(FLAGS_input);
+      if (stream && !path.empty()) {
+        absl::StatusOr<LineStream> opened = LineStream::Open(path);
+        read = opened.status();
+        if (opened.ok()) {
+          lines.emplace(*std::move(opened));
+        }
+      } else if (stream) {
+        // The day's own input is embedded or a literal, so it is already in
+        // memory. Stream it from wherever DayInput finds it, which works from
+        // any directory.
+        day_input = DayInput::Open(info);
+        read = day_input.status();
+        if (day_input.ok()) {
+          lines.emplace(day_input->Contents());
+        }
+      } else {
+        day_input = DayInput::Open(info, path);
+        read = day_input.status();
+      }
+    }
+    if (!read.ok()) {
+      std::print(stderr, "Failed to read input for {}: {}\n", name,
+                 read.ToString());
+      return 1;
+    }
+    if (day_input.ok()) {
+      input = day_input->Contents();
+    }
+
+    // Indexed by part - 1.
+    std::array<AnswerKey, 2> keys;
+    std::array<std::optional<std::string>, 2> cached;
+    if (use_cache) {
+      AOC_SCOPED_TIMER("cache lookup");
+      const std::string input_hash = HashInput(input);
+      for (int i = 0; i < 2; ++i) {
+        keys[i] = {.day = name,
+                   .part = i + 1,
+                   .version = info.version,
+                   .input_hash = input_hash};
+        absl::StatusOr<std::optional<std::string>> answer =
+            cache.Lookup(keys[i]);
+        if (answer.ok()) {
+          cached[i] = *std::move(answer);
+        } else {
+          warn(answer.status());
+        }
+      }
+    }
+
+    std::array<std::string, 2> answers;
+    const bool solve = cache_mode != "on" || !cached[0].has_value() ||
+                       !cached[1].has_value();
+
+    if (solve && info.examples != nullptr) {
+      AOC_SCOPED_TIMER("examples");
+      info.examples();
+    }
+
+    // Runs one phase under its trace timer and, with --perf and --alloc,
+    // its counters. Allocations are counted on every thread, so work a day
+    // hands to the thread pool is included.
+    auto run_phase = [&](std::string_view phase, auto&& fn) {
+      ScopedTimer timer(phase);
+      AllocationCounter allocs(AllocScope::kProcess);
+      if (count_allocs) allocs.Start();
+      if (count_perf) perf.Start();
+      fn();
+      if (count_perf) {
+        perf_samples.push_back(
+            {.name = std::string(phase), .counts = perf.Stop()});
+      }
+      if (count_allocs) {
+        alloc_samples.push_back(
+            {.name = std::string(phase), .stats = allocs.Stop()});
+      }
+    };
+    if (solve) {
+      absl::Status parsed;
+      run_phase("parse", [&] {
+        if (lines.has_value()) {
+          parsed = day.ParseStream(*lines);
+        } else {
+          day.Parse(input);
+        }
+      });
+      if (!parsed.ok()) {
+        std::print(stderr, "Failed to parse input for {}: {}\n", name,
+                   parsed.ToString());
+        return 1;
+      }
+      run_phase("part1", [&] { answers[0] = day.Part1(); });
+      run_phase("part2", [&] { answers[1] = day.Part2(); });
+    } else {
+      answers = {*cached[0], *cached[1]};
+    }
+    {
+      AOC_SCOPED_TIMER("output");
+      std::print("Part 1: {}\nPart 2: {}\n", answers[0], answers[1]);
+      std::fflush(stdout);
+    }
+
+    if (use_cache && solve) {
+      AOC_SCOPED_TIMER("cache store");
+      for (int i = 0; i < 2; ++i) {
+        if (!cached[i].has_value()) {
+          if (absl::Status status = cache.Store(keys[i], answers[i]);
+              !status.ok()) {
+            warn(status);
+          }
+        } else if (*cached[i] != answers[i]) {
+          std::print(stderr,
+                     "{} part {}: solved {}, but the cache has {}. Bump "
+                     "DayInfo::version if the solution changed.\n",
+                     name, i + 1, answers[i], *cached[i]);
+          verify_failed = true;
+        }
+      }
+    }
+  }
+  if (absl::Status status = FinishTracing(trace_path); !status.ok()) {
+    std::print(stderr, "{}\n", status.ToString());
+    return 1;
+  }
+  if (verify_failed) {
+    return 1;
+  }
+
+  if (count_perf) {
+    std::print("\n");
+    if (!perf.status().ok()) {
+      std::print("Hardware counters unavailable: {}\n",
+                 perf.status().ToString());
+    }
+    PrintPerfTable(perf_samples);
+  }
+  if (count_allocs) {
+    std::print("\n");
+    if (!AllocationTrackingAvailable()) {
+      std::print(
+          "Allocation hooks not linked in; build with --config=alloc.\n");
+    }
+    PrintAllocTable(alloc_samples);
+  }
+
+  if (!absl::GetFlag(FLAGS_bench)) {
+    return 0;
+  }
+  // Throughput is reported in input bytes per second.
+  const BenchOptions options{.items_per_run =
+                                 static_cast<int64_t>(input.size())};
+  std::vector<BenchResult> results = {
+      Bench("parse", [&] { day.Parse(input); }, options),
+      Bench("part1", [&] { return day.Part1(); }, options),
+      Bench("part2", [&] { return day.Part2(); }, options),
+  };
+  std::print("\n");
+  PrintBenchTable(results);
+
+  std::string json_path = absl::GetFlag(FLAGS_bench_json);
+  if (!json_path.empty()) {
+    std::ofstream json(json_path);
+    json << BenchResultsToJson(results);
+  }
+  return 0;
+}
+
+struct BatchResult {
+  std::string part1;
+  std::string part2;
+  double parse_ns = 0;
+  double part1_ns = 0;
+  double part2_ns = 0;
+  // Set if the input could not be read.
+  std::string error;
+
+  double TotalNs() const { return parse_ns + part1_ns + part2_ns; }
+};
+
+template <typename F>
+double TimeNs(F&& fn) {
+  const auto start = std::chrono::steady_clock::now();
+  fn();
+  return std::chrono::duration<double, std::nano>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+// The files named on the command line, with each directory replaced by the
+// regular files directly inside it, in name order.
+absl::StatusOr<std::vector<std::string>> ListBatchInputs(
+    std::span<char* const> args) {
+  std::vector<std::string> paths;
+  for (const char* arg : args) {
+    struct stat arg_stat;
+    if (::stat(arg, &arg_stat) != 0 || !S_ISDIR(arg_stat.st_mode)) {
+      paths.push_back(arg);
+      continue;
+    }
+    DIR* dir = ::opendir(arg);
+    if (dir == nullptr) {
+      return absl::UnavailableError(
+          std::format("Could not list {}: {}", arg, std::strerror(errno)));
+    }
+    std::vector<std::string> files;
+    while (const dirent* entry = ::readdir(dir)) {
+      std::string path = std::format("{}/{}", arg, entry->d_name);
+      struct stat entry_stat;
+      if (::stat(path.c_str(), &entry_stat) == 0 &&
+          S_ISREG(entry_stat.st_mode)) {
+        files.push_back(std::move(path));
+      }
+    }
+    ::closedir(dir);
+    std::sort(files.begin(), files.end());
+    paths.insert(paths.end(), files.begin(), files.end());
+  }
+  return paths;
+}
+
+// Solves every input in `paths`. Each worker makes one Day and reuses it for
+// every input it takes, so whatever the Day keeps between Parse() calls
+// (tables, scratch space, warm caches) is paid for once per worker rather
+// than once per input.
+int RunBatch(const RegisteredDay& registered,
+             const std::vector<std::string>& paths) {
+  const DayInfo& info = registered.info;
+  if (info.examples != nullptr) {
+    info.examples();
+  }
+
+  std::vector<BatchResult> results(paths.size());
+  std::atomic<size_t> next{0};
+  auto work = [&] {
+    std::unique_ptr<Day> day = registered.make();
+    for (size_t i = next++; i < paths.size(); i = next++) {
+      BatchResult& result = results[i];
+      absl::StatusOr<DayInput> input = DayInput::Open(info, paths[i]);
+      if (!input.ok()) {
+        result.error = input.status().ToString();
+        continue;
+      }
+      result.parse_ns = TimeNs([&] { day->Parse(input->Contents()); });
+      result.part1_ns = TimeNs([&] { result.part1 = day->Part1(); });
+      result.part2_ns = TimeNs([&] { result.part2 = day->Part2(); });
+    }
+  };
+  const double wall_ns = TimeNs([&] {
+    ThreadPool& pool = DefaultThreadPool();
+    const int workers =
+        absl::GetFlag(FLAGS_batch_parallel)
+            ? std::min<int64_t>(pool.NumThreads(), paths.size())
+            : 0;
+    if (workers <= 1) {
+      work();
+      return;
+    }
+    TaskGroup group(pool);
+    for (int i = 0; i < workers; ++i) {
+      group.Run(work);
+    }
+    group.Wait();
+  });
+
+  std::print("{:<32} {:>10} {:>10} {:>10} {:>10}   {:<16} {}\n", "input",
+             "parse", "part1", "part2", "total", "part 1", "part 2");
+  std::vector<double> latencies_ns;
+  int failures = 0;
+  for (size_t i = 0; i < paths.size(); ++i) {
+    const BatchResult& result = results[i];
+    if (!result.error.empty()) {
+      std::print("{:<32} {}\n", paths[i], result.error);
+      ++failures;
+      continue;
+    }
+    latencies_ns.push_back(result.TotalNs());
+    std::print("{:<32} {:>10} {:>10} {:>10} {:>10}   {:<16} {}\n", paths[i],
+               FormatNanoseconds(result.parse_ns),
+               FormatNanoseconds(result.part1_ns),
+               FormatNanoseconds(result.part2_ns),
+               FormatNanoseconds(result.TotalNs()), result.part1,
+               result.part2);
+  }
+  std::print("\n");
+  if (!latencies_ns.empty()) {
+    const BenchResult latency = SummarizeBenchSamples(
+        "latency", std::move(latencies_ns), /*items_per_run=*/1);
+    PrintBenchTable({&latency, 1});
+  }
+  std::print("\n{} inputs, {} failed. Wall time: {} ({:.1f} inputs/s).\n",
+             paths.size(), failures, FormatNanoseconds(wall_ns),
+             paths.size() * 1e9 / wall_ns);
+  return failures == 0 ? 0 : 1;
+}
+
+}  // namespace
+
+int RunDay(int argc, char** argv, const RegisteredDay& registered) {
+  std::vector<char*> args = absl::ParseCommandLine(argc, argv);
+  if (args.size() <= 1) {
+    std::unique_ptr<Day> day = registered.make();
+    return RunSingle(*day);
+  }
+  // A batch reads every input whole and times it itself, so the flags that
+  // pick, stream, cache or measure a single solve don't apply.
+  const std::vector<std::pair<std::string_view, bool>> single_only = {
+      {"--input", !absl::GetFlag(FLAGS_input).empty()},
+      {"--bench", absl::GetFlag(FLAGS_bench)},
+      {"--bench_json", !absl::GetFlag(FLAGS_bench_json).empty()},
+      {"--alloc", absl::GetFlag(FLAGS_alloc)},
+      {"--perf", absl::GetFlag(FLAGS_perf)},
+      {"--trace_json", !absl::GetFlag(FLAGS_trace_json).empty()},
+      {"--stream", absl::GetFlag(FLAGS_stream)},
+      {"--answer_cache", absl::GetFlag(FLAGS_answer_cache) != "off"},
+  };
+  bool rejected = false;
+  for (const auto& [flag, set] : single_only) {
+    if (set) {
+      std::print(stderr, "{} can't be combined with a list of inputs.\n",
+                 flag);
+      rejected = true;
+    }
+  }
+  if (rejected) {
+    return 1;
+  }
+  absl::StatusOr<std::vector<std::string>> paths =
+      ListBatchInputs(std::span(args).subspan(1));
+  if (!paths.ok()) {
+    std::print(stderr, "{}\n", paths.status().ToString());
+    return 1;
+  }
+  return RunBatch(registered, *paths);
+}
+
+}  // namespace aoc
@@ -0,0 +1,269 @@
+#pragma once
+#include <format>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "utils/line_stream.h"
+#include "utils/mapped_input.h"
+
+namespace aoc {
+
+// Static facts about a day's solution.
+struct DayInfo {
+  int year = 0;
+  int day = 0;
+  // The checked-in puzzle input, relative to the workspace root, e.g.
+  // "./2015/day1.txt".
+  std::string_view input_file;
+  // The puzzle input itself, for days whose input is a one-liner that lives
+  // in the source. Used when input_file is empty.
+  std::string_view input_literal;
+  // Distinguishes alternate solutions of the same day, e.g. "alternate".
+  std::string_view variant;
+  // Part of the answer cache key (utils/answer_cache.h). Bump it when a
+  // change could alter the answers, so cached ones are not reused.
+  int version = 0;
+  // Optional checks against the puzzle's worked examples. Run once before the
+  // real input is solved, never timed.
+  void (*examples)() = nullptr;
+};
+
+// "2015/day7", or "2015/day7 (alternate)" for a variant.
+std::string DayName(const DayInfo& info);
+
+// The text a day solves: its input file, memory-mapped, or its literal.
+class DayInput {
+ public:
+  // Opens `path`, or the day's own input when `path` is empty. The day's own
+  // input comes from the copy embedded at build time when there is one.
+  static absl::StatusOr<DayInput> Open(const DayInfo& info,
+                                       std::string_view path = "");
+
+  std::string_view Contents() const {
+    return file_.has_value() ? file_->Contents() : literal_;
+  }
+
+ private:
+  std::optional<MappedInput> file_;
+  std::string_view literal_;
+};
+
+// A day's solution, split into phases so they can be run and timed
+// separately. Parse() keeps whatever it parsed in the Day, and the parts read
+// it from there, so each part can be rerun without reparsing.
+class Day {
+ public:
+  virtual ~Day() = default;
+
+  virtual const DayInfo& info() const = 0;
+
+  // Parses `input`, replacing anything parsed before. `input` must stay alive
+  // until the parts that follow have returned, so a day can keep views into
+  // it instead of copying it.
+  virtual void Parse(std::string_view input) = 0;
+
+  // Parses a line at a time, for inputs too big to hold in memory. Only days
+  // whose Parse function takes a LineStream& support it.
+  virtual absl::Status ParseStream(LineStream& lines) {
+    return absl::UnimplementedError("This day can't parse a stream of lines.");
+  }
+
+  // Solve the parsed input. Must only be called after Parse().
+  virtual std::string Part1() = 0;
+  virtual std::string Part2() = 0;
+};
+
+namespace day_internal {
+
+template <typename T>
+struct IsOptional : std::false_type {};
+template <typename T>
+struct IsOptional<std::optional<T>> : std::true_type {};
+
+template <typename T>
+std::string FormatAnswer(const T& answer) {
+  if constexpr (IsOptional<T>::value) {
+    return answer.has_value() ? FormatAnswer(*answer) : "none";
+  } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+    return std::string(std::string_view(answer));
+  } else {
+    return std::format("{}", answer);
+  }
+}
+
+// What a day's Parse function takes and makes.
+template <typename ParseFn>
+struct ParseTraits {
+  static constexpr bool kParsesLines =
+      std::is_invocable_v<ParseFn, LineStream&>;
+  static constexpr bool kParsesInto = false;
+  using Input = std::decay_t<std::invoke_result_t<
+      ParseFn,
+      std::conditional_t<kParsesLines, LineStream&, std::string_view>>>;
+};
+
+template <typename T>
+struct ParseTraits<void (*)(std::string_view, T&)> {
+  static constexpr bool kParsesLines = false;
+  static constexpr bool kParsesInto = true;
+  using Input = T;
+};
+
+// Adapts free Parse/Part1/Part2 functions to the Day interface.
+//   Input Parse(std::string_view input);  // Or Parse(aoc::LineStream& lines),
+//                                         // which also supports ParseStream.
+//                                         // Input may be a view into `input`.
+//   Answer Part1(const Input& input);  // std::format-able, or an optional of
+//                                      // one ("none" when empty).
+//   Answer Part2(const Input& input);
+//
+// A day whose Input holds big buffers can instead take the Input to fill:
+//   void Parse(std::string_view input, Input& parsed);
+// The Day default-constructs `parsed` once and hands the same one back on
+// every later Parse, so a Day reused across inputs (see RunDay) keeps its
+// buffers. Parse must clear what it refills.
+template <typename ParseFn, typename Part1Fn, typename Part2Fn>
+class FunctionDay : public Day {
+ public:
+  static constexpr bool kParsesLines = ParseTraits<ParseFn>::kParsesLines;
+  static constexpr bool kParsesInto = ParseTraits<ParseFn>::kParsesInto;
+  using Input = typename ParseTraits<ParseFn>::Input;
+
+  FunctionDay(DayInfo info, ParseFn parse, Part1Fn part1, Part2Fn part2)
+      : info_(info), parse_(parse), part1_(part1), part2_(part2) {}
+
+  const DayInfo& info() const override { return info_; }
+
+  void Parse(std::string_view input) override {
+    if constexpr (kParsesInto) {
+      if (!input_.has_value()) {
+        input_.emplace();
+      }
+      parse_(input, *input_);
+    } else if constexpr (kParsesLines) {
+      LineStream lines(input);
+      input_.emplace(parse_(lines));
+    } else {
+      input_.emplace(parse_(input));
+    }
+  }
+
+  absl::Status ParseStream(LineStream& lines) override {
+    if constexpr (kParsesLines) {
+      input_.emplace(parse_(lines));
+      return lines.status();
+    } else {
+      return Day::ParseStream(lines);
+    }
+  }
+
+  std::string Part1() override { return FormatAnswer(part1_(*input_)); }
+  std::string Part2() override { return FormatAnswer(part2_(*input_)); }
+
+ private:
+  DayInfo info_;
+  ParseFn parse_;
+  Part1Fn part1_;
+  Part2Fn part2_;
+  std::optional<Input> input_;
+};
+
+}  // namespace day_internal
+
+template <typename ParseFn, typename Part1Fn, typename Part2Fn>
+std::unique_ptr<Day> MakeDay(DayInfo info, ParseFn parse, Part1Fn part1,
+                             Part2Fn part2) {
+  return std::make_unique<
+      day_internal::FunctionDay<ParseFn, Part1Fn, Part2Fn>>(info, parse, part1,
+                                                            part2);
+}
+
+struct RegisteredDay {
+  DayInfo info;
+  // Returns a new, unparsed instance of the day.
+  std::function<std::unique_ptr<Day>()> make;
+};
+
+// Runs a day as a program: parses flags, runs the examples, then parses and
+// solves the input and prints both answers.
+//
+// Given input files or directories as arguments, solves every file instead
+// and prints how long each took:
+//
+//   day7 inputs/               Every file in inputs/.
+//   day7 a.txt b.txt           Just these.
+//
+// Inputs are spread across the default thread pool. Each worker reuses one
+// Day for all of its inputs, so a batch pays for process startup and setup
+// once, and days that parse into their Input reuse its buffers too.
+//
+// A batch only takes --batch_parallel. The flags that pick, stream, cache,
+// trace or measure a single input are an error alongside a list of inputs.
+//
+// Flags:
+//   --input=PATH       Solve PATH instead of the checked-in input.
+//   --bench            Time Parse, Part1 and Part2 with the aoc::Bench
+//                      harness and print a table after the answers.
+//   --bench_json=PATH  Also write the timings to PATH as JSON.
+//   --alloc            Count heap allocations for each phase (utils/
+//                      alloc_stats.h) and print a table.
+//   --perf             Count cycles, instructions, cache and branch misses
+//                      for each phase with perf_event_open (utils/
+//                      perf_counters.h) and print a table.
+//   --trace_json=PATH  Trace each phase with AOC_SCOPED_TIMER, print a summary
+//                      and write a Chrome trace to PATH (utils/trace.h).
+//   --answer_cache=off|on|verify
+//                      "off" (the default) always solves. "on" returns
+//                      answers cached by an earlier run on the same input
+//                      without solving; "verify" solves anyway and fails if
+//                      the cached answers differ. Not used with --bench,
+//                      --alloc or --perf.
+//   --answer_cache_dir=PATH
+//                      Where cached answers live; see DefaultAnswerCacheDir().
+//   --stream           Read the input with a LineStream instead of all at
+//                      once, for days whose Parse takes one. With --input,
+//                      memory use then stays flat however big the file is;
+//                      the day's own input is streamed from its embedded copy
+//                      or literal.
+//   --batch_parallel   Solve a batch concurrently (the default). With
+//                      --nobatch_parallel, inputs are solved one at a time.
+int RunDay(int argc, char** argv, const RegisteredDay& day);
+
+// Adds a day to the registry. Use AOC_REGISTER_DAY rather than calling this
+// directly. Always returns true.
+bool RegisterDay(RegisteredDay day);
+
+template <typename ParseFn, typename Part1Fn, typename Part2Fn>
+bool RegisterDay(DayInfo info, ParseFn parse, Part1Fn part1, Part2Fn part2) {
+  return RegisterDay({.info = info, .make = [=] {
+                        return MakeDay(info, parse, part1, part2);
+                      }});
+}
+
+// Every day linked into this binary, ordered by year, day and variant.
+std::vector<RegisteredDay> RegisteredDays();
+
+}  // namespace aoc
+
+#define AOC_DAY_CONCAT_INNER(a, b) a##b
+#define AOC_DAY_CONCAT(a, b) AOC_DAY_CONCAT_INNER(a, b)
+
+// Registers a day's solution, at namespace scope in the day's .cc file:
+//
+//   AOC_REGISTER_DAY({.year = 2015, .day = 1, .input_file = "./2015/day1.txt"},
+//                    Parse, Part1, Part2);
+//
+// Build the file with aoc_day() from //utils:defs.bzl. That links it into its
+// own binary, whose main() comes from //utils:day_main and calls RunDay(), and
+// into //runner:aoc_runner alongside every other day.
+#define AOC_REGISTER_DAY(...)                        \
+  [[maybe_unused]] static const bool AOC_DAY_CONCAT( \
+      aoc_registered_day_, __COUNTER__) = ::aoc::RegisterDay(__VA_ARGS__)
@@ -0,0 +1,13 @@
+// main() for a single day's binary. The day registers itself with
+// AOC_REGISTER_DAY; see aoc_day() in //utils:defs.bzl.
+
+#include <vector>
+
+#include "absl/log/check.h"
+#include "utils/day.h"
+
+int main(int argc, char** argv) {
+  std::vector<aoc::RegisteredDay> days = aoc::RegisteredDays();
+  CHECK_EQ(days.size(), 1u) << "Expected exactly one registered day.";
+  return aoc::RunDay(argc, argv, days.front());
+}
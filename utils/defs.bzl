@@ -0,0 +1,97 @@
+"""Build rules for Advent of Code solutions."""
+
+_DAY_TAG = "aoc_day"
+
+# //utils:alloc_hooks under --config=alloc, nothing otherwise.
+ALLOC_HOOKS = select({
+    "//utils:alloc_hooks_enabled": ["//utils:alloc_hooks"],
+    "//conditions:default": [],
+})
+
+def aoc_day(name, srcs, data = [], deps = []):
+    """A day's solution, built both as its own binary and as a library.
+
+    The sources must register the day with AOC_REGISTER_DAY (utils/day.h).
+    `bazel run //2015:day1` runs it on its own; aoc_days() collects the
+    library into //runner:aoc_runner; and `bazel test //2015:day1_test` checks
+    its answers and budgets (see aoc_day_test()).
+
+    The `data` files are also compiled into the library (see
+    utils/embedded_input.h), so the binaries find their input from any
+    directory.
+
+    Args:
+      name: The binary's name, e.g. "day1". The library is name + "_lib".
+      srcs: The day's sources.
+      data: Input files the day reads.
+      deps: The day's dependencies, including //utils:day.
+    """
+    embedded_srcs = []
+    if data:
+        native.genrule(
+            name = name + "_embed",
+            srcs = data,
+            outs = [name + "_embedded.cc"],
+            tools = ["//utils:embed"],
+            cmd = "$(location //utils:embed) $@ " + " ".join([
+                "%s/%s=$(location %s)" % (native.package_name(), file, file)
+                for file in data
+            ]),
+        )
+        embedded_srcs = [name + "_embedded.cc"]
+    native.cc_library(
+        name = name + "_lib",
+        srcs = srcs + embedded_srcs,
+        data = data,
+        deps = deps + ["//utils:embedded_input"],
+        # Nothing references the registration, so make sure the linker keeps
+        # it.
+        alwayslink = True,
+        tags = [_DAY_TAG],
+    )
+    native.cc_binary(
+        name = name,
+        deps = [
+            ":" + name + "_lib",
+            "//utils:day_main",
+        ] + ALLOC_HOOKS,
+    )
+    aoc_day_test(name = name + "_test", day = ":" + name + "_lib")
+
+def aoc_day_test(name, day):
+    """A test that solves a day and checks it against runner/budgets.json.
+
+    Fails on a wrong answer, or on more allocations or (under -c opt) more time
+    than the day's budget allows; see runner/day_test.cc. aoc_day() declares
+    one for every day.
+
+    Args:
+      name: The test's name, e.g. "day1_test".
+      day: The day's library, e.g. ":day1_lib".
+    """
+    native.cc_test(
+        name = name,
+        data = ["//runner:budgets.json"],
+        deps = [
+            day,
+            "//runner:day_test",
+            "//utils:alloc_hooks",
+            "@googletest//:gtest_main",
+        ],
+    )
+
+def aoc_days(name):
+    """A library of every aoc_day() declared above it in the package.
+
+    Args:
+      name: The library's name.
+    """
+    native.cc_library(
+        name = name,
+        visibility = ["//visibility:public"],
+        deps = [
+            ":" + rule["name"]
+            for rule in native.existing_rules().values()
+            if _DAY_TAG in rule.get("tags", [])
+        ],
+    )
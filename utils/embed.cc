@@ -0,0 +1,76 @@
+// Writes a C++ source that embeds files with RegisterEmbeddedInput
+// (utils/embedded_input.h). Run by aoc_day(); see //utils:defs.bzl.
+//
+// Usage: embed OUTPUT.cc KEY=FILE [KEY=FILE...]
+
+#include <cstdio>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <print>
+#include <string>
+#include <string_view>
+
+namespace {
+
+// The bytes as a sequence of adjacent string literals, one per input line.
+// Octal escapes are at most three digits, so they can't run into whatever
+// character follows.
+std::string ToLiteral(std::string_view bytes) {
+  std::string literal = "    \"";
+  for (char c : bytes) {
+    if (c == '\n') {
+      literal += "\\n\"\n    \"";
+    } else if (c == '"' || c == '\\') {
+      literal += '\\';
+      literal += c;
+    } else if (c >= 0x20 && c < 0x7f) {
+      literal += c;
+    } else {
+      literal += std::format("\\{:03o}", static_cast<unsigned char>(c));
+    }
+  }
+  literal += '"';
+  return literal;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    std::print(stderr, "Usage: {} OUTPUT.cc KEY=FILE...\n", argv[0]);
+    return 1;
+  }
+  std::string source =
+      "// Generated by //utils:embed. Do not edit.\n\n"
+      "#include \"utils/embedded_input.h\"\n\n"
+      "namespace {\n";
+  for (int i = 2; i < argc; ++i) {
+    std::string_view arg = argv[i];
+    size_t equals = arg.find('=');
+    if (equals == std::string_view::npos) {
+      std::print(stderr, "Expected KEY=FILE, got {}\n", arg);
+      return 1;
+    }
+    std::string_view key = arg.substr(0, equals);
+    std::string path(arg.substr(equals + 1));
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+      std::print(stderr, "Could not read {}\n", path);
+      return 1;
+    }
+    std::string bytes((std::istreambuf_iterator<char>(file)),
+                      std::istreambuf_iterator<char>());
+    source += std::format(
+        "\nconstexpr char kFile{0}[] =\n{1};\n"
+        "[[maybe_unused]] const bool registered{0} =\n"
+        "    aoc::RegisterEmbeddedInput(\"{2}\",\n"
+        "                               {{kFile{0}, sizeof(kFile{0}) - 1}});\n",
+        i - 2, ToLiteral(bytes), key);
+  }
+  source += "\n}  // namespace\n";
+
+  std::ofstream out(argv[1], std::ios::binary);
+  out << source;
+  return out ? 0 : 1;
+}
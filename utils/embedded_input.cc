@@ -0,0 +1,36 @@
+#include "utils/embedded_input.h"
+
+#include <optional>
+#include <string_view>
+
+#include "absl/container/flat_hash_map.h"
+
+namespace aoc {
+namespace {
+
+// Filled in by static initializers, so it must be constructed on first use.
+absl::flat_hash_map<std::string_view, std::string_view>& Registry() {
+  static auto* registry =
+      new absl::flat_hash_map<std::string_view, std::string_view>();
+  return *registry;
+}
+
+std::string_view Normalize(std::string_view path) {
+  if (path.starts_with("./")) path.remove_prefix(2);
+  return path;
+}
+
+}  // namespace
+
+bool RegisterEmbeddedInput(std::string_view path, std::string_view contents) {
+  Registry()[Normalize(path)] = contents;
+  return true;
+}
+
+std::optional<std::string_view> FindEmbeddedInput(std::string_view path) {
+  auto it = Registry().find(Normalize(path));
+  if (it == Registry().end()) return std::nullopt;
+  return it->second;
+}
+
+}  // namespace aoc
@@ -0,0 +1,22 @@
+#pragma once
+#include <optional>
+#include <string_view>
+
+namespace aoc {
+
+// Puzzle inputs compiled into the binary.
+//
+// aoc_day() (//utils:defs.bzl) turns each of a day's `data` files into a
+// generated source that registers the file's bytes under its workspace path,
+// e.g. "2015/day7.txt". DayInput::Open looks here before touching the
+// filesystem, so day binaries and the runner work from any directory and
+// never read their input at startup. --input still reads a file at runtime.
+
+// Registers `contents`, which must stay alive forever, under `path`. Called
+// from static initializers in the generated sources.
+bool RegisterEmbeddedInput(std::string_view path, std::string_view contents);
+
+// The embedded contents of `path`, if any. A leading "./" is ignored.
+std::optional<std::string_view> FindEmbeddedInput(std::string_view path);
+
+}  // namespace aoc
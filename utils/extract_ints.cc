@@ -0,0 +1,109 @@
+#include "utils/extract_ints.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace aoc {
+namespace {
+
+bool IsDigit(char c) { return static_cast<unsigned char>(c - '0') < 10; }
+
+// Returns the position of the first ASCII digit at or after `pos`, or
+// input.size() if there is none.
+size_t FindDigit(std::string_view input, size_t pos) {
+  const char* data = input.data();
+  const size_t size = input.size();
+#if defined(__SSE2__)
+  const __m128i zero = _mm_set1_epi8('0');
+  const __m128i nine = _mm_set1_epi8(9);
+  while (pos + 16 <= size) {
+    __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+    // c - '0' <= 9 (unsigned) <=> min(c - '0', 9) == c - '0'.
+    __m128i offset = _mm_sub_epi8(chunk, zero);
+    __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(offset, nine), offset);
+    int mask = _mm_movemask_epi8(is_digit);
+    if (mask != 0) {
+      return pos + __builtin_ctz(mask);
+    }
+    pos += 16;
+  }
+#else
+  constexpr uint64_t kOnes = 0x0101010101010101ULL;
+  constexpr uint64_t kHigh = 0x8080808080808080ULL;
+  while (pos + 8 <= size) {
+    uint64_t word;
+    std::memcpy(&word, data + pos, sizeof(word));
+    // High bit of each byte set iff the low 7 bits are >= '0'.
+    uint64_t ge_zero = ((word | kHigh) - '0' * kOnes) & kHigh;
+    // High bit of each byte set iff the low 7 bits are > '9'.
+    uint64_t gt_nine = ((word & ~kHigh) + (0x7F - '9') * kOnes) & kHigh;
+    // Bytes >= 0x80 are never digits.
+    uint64_t digits = ge_zero & ~gt_nine & ~word;
+    if (digits != 0) {
+      // Little endian: the lowest set bit is the first byte in memory.
+      return pos + __builtin_ctzll(digits) / 8;
+    }
+    pos += 8;
+  }
+#endif
+  while (pos < size && !IsDigit(data[pos])) {
+    ++pos;
+  }
+  return pos;
+}
+
+// Calls `emit(value)` for every integer in `input` until it returns false.
+template <typename Emit>
+void ScanInts(std::string_view input, Emit emit) {
+  const char* data = input.data();
+  const size_t size = input.size();
+  size_t pos = 0;
+  while (true) {
+    pos = FindDigit(input, pos);
+    if (pos >= size) {
+      return;
+    }
+    bool negative = pos > 0 && data[pos - 1] == '-';
+    uint64_t value = 0;
+    while (pos < size && IsDigit(data[pos])) {
+      value = value * 10 + static_cast<uint64_t>(data[pos] - '0');
+      ++pos;
+    }
+    int64_t signed_value = static_cast<int64_t>(negative ? 0 - value : value);
+    if (!emit(signed_value)) {
+      return;
+    }
+  }
+}
+
+}  // namespace
+
+size_t ExtractInts(std::string_view input, std::span<int64_t> out) {
+  size_t count = 0;
+  if (out.empty()) {
+    return 0;
+  }
+  ScanInts(input, [&](int64_t value) {
+    out[count++] = value;
+    return count < out.size();
+  });
+  return count;
+}
+
+void ExtractInts(std::string_view input, std::vector<int64_t>& out) {
+  ScanInts(input, [&](int64_t value) {
+    out.push_back(value);
+    return true;
+  });
+}
+
+}  // namespace aoc
@@ -0,0 +1,48 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace aoc {
+
+// Regex-free integer extraction.
+//
+// Finds every integer in `input`, in order, the way the pattern -?\d+ would.
+// A '-' directly in front of a digit makes the number negative. Everything
+// else is treated as a separator. Runs of non-digits are skipped 16 (SSE2) or
+// 8 (SWAR) bytes at a time, so prose-heavy lines like
+//   "Comet can fly 14 km/s for 10 seconds, but then must rest for 127 seconds."
+// cost a handful of word compares instead of a std::regex_search.
+//
+// Values that do not fit in an int64_t wrap silently.
+
+// Writes up to out.size() integers into `out`. Returns the number written.
+size_t ExtractInts(std::string_view input, std::span<int64_t> out);
+
+// Appends every integer in `input` to `out`.
+void ExtractInts(std::string_view input, std::vector<int64_t>& out);
+
+// Returns the first N integers in `input` as T. Missing values are 0.
+// Usage:
+//   auto [x1, y1, x2, y2] = aoc::ExtractInts<4>(line);
+//   auto [rate, duration] = aoc::ExtractInts<2, int>(line);
+template <size_t N, typename T = int64_t>
+std::array<T, N> ExtractInts(std::string_view input) {
+  std::array<int64_t, N> values{};
+  ExtractInts(input, std::span<int64_t>(values));
+  if constexpr (std::is_same_v<T, int64_t>) {
+    return values;
+  } else {
+    std::array<T, N> converted{};
+    for (size_t i = 0; i < N; ++i) {
+      converted[i] = static_cast<T>(values[i]);
+    }
+    return converted;
+  }
+}
+
+}  // namespace aoc
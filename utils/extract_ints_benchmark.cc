@@ -0,0 +1,91 @@
+// Compares aoc::ExtractInts against the std::regex parsers it replaced.
+//
+// Usage: bazel run -c opt //utils:extract_ints_benchmark
+
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <print>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "utils/extract_ints.h"
+
+namespace {
+
+constexpr int kLinesPerPattern = 20000;
+
+struct Pattern {
+  std::string name;
+  std::string line;
+  std::regex regex;
+};
+
+// Keeps the optimizer from throwing away the parsed values.
+int64_t sink = 0;
+
+template <typename F>
+double TimeNsPerLine(const std::vector<std::string>& lines, F parse) {
+  auto start = std::chrono::steady_clock::now();
+  for (const std::string& line : lines) {
+    sink += parse(line);
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() /
+         lines.size();
+}
+
+}  // namespace
+
+int main() {
+  std::vector<Pattern> patterns = {
+      {"2024 day1", "38665   13337", std::regex(R"((\d+)\s+(\d+))")},
+      {"2015 day6", "turn off 499,499 through 500,500",
+       std::regex(
+           R"((turn on|turn off|toggle) (\d+),(\d+) through (\d+),(\d+))")},
+      {"2015 day14",
+       "Comet can fly 14 km/s for 10 seconds, but then must rest for 127 "
+       "seconds.",
+       std::regex(R"((\w+) can fly (\d+) km/s for (\d+) seconds, but then )"
+                  R"(must rest for (\d+) seconds.)")},
+      {"2015 day15",
+       "Butterscotch: capacity -1, durability -2, flavor 6, texture 3, "
+       "calories 8",
+       std::regex(R"((\w+): capacity (-?\d+), durability (-?\d+), flavor )"
+                  R"((-?\d+), texture (-?\d+), calories (-?\d+))")},
+  };
+
+  std::print("{:<12} {:>14} {:>15} {:>9}\n", "input", "regex ns/line",
+             "extract ns/line", "speedup");
+  for (const Pattern& pattern : patterns) {
+    std::vector<std::string> lines(kLinesPerPattern, pattern.line);
+
+    double regex_ns = TimeNsPerLine(lines, [&](const std::string& line) {
+      std::smatch match;
+      std::regex_search(line, match, pattern.regex);
+      int64_t sum = 0;
+      for (size_t i = 1; i < match.size(); ++i) {
+        if (match[i].length() > 0 && (std::isdigit(match[i].str().back()))) {
+          sum += std::stoll(match[i].str());
+        }
+      }
+      return sum;
+    });
+
+    std::vector<int64_t> values;
+    double extract_ns = TimeNsPerLine(lines, [&](const std::string& line) {
+      values.clear();
+      aoc::ExtractInts(line, values);
+      int64_t sum = 0;
+      for (int64_t value : values) {
+        sum += value;
+      }
+      return sum;
+    });
+
+    std::print("{:<12} {:>14.1f} {:>15.1f} {:>8.1f}x\n", pattern.name,
+               regex_ns, extract_ns, regex_ns / extract_ns);
+  }
+  return sink == 42 ? 1 : 0;
+}
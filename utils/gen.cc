@@ -0,0 +1,63 @@
+#include "utils/gen.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <print>
+#include <string>
+
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+
+ABSL_FLAG(int64_t, size, -1,
+          "How big an input to generate. Defaults to the generator's own "
+          "default, which is about the size of the real input.");
+ABSL_FLAG(uint64_t, seed, 1, "Random seed.");
+ABSL_FLAG(std::string, output, "", "Write here instead of to stdout.");
+
+namespace aoc {
+
+void Generator::Flush() {
+  if (std::fwrite(buffer_.data(), 1, buffer_.size(), out_) != buffer_.size()) {
+    failed_ = true;
+  }
+  buffer_.clear();
+}
+
+int RunGenerator(int argc, char** argv, const GeneratorInfo& info,
+                 void (*generate)(Generator& gen)) {
+  absl::ParseCommandLine(argc, argv);
+  int64_t size = absl::GetFlag(FLAGS_size);
+  if (size < 0) {
+    size = info.default_size;
+  }
+
+  std::string path = absl::GetFlag(FLAGS_output);
+  std::FILE* out = stdout;
+  if (!path.empty()) {
+    out = std::fopen(path.c_str(), "wb");
+    if (out == nullptr) {
+      std::print(stderr, "Could not open {} for writing.\n", path);
+      return 1;
+    }
+  }
+  bool ok;
+  {
+    Generator gen(size, absl::GetFlag(FLAGS_seed), out);
+    generate(gen);
+    gen.Flush();
+    ok = !gen.failed();
+  }
+  // Buffered writes can fail as late as the final flush or close.
+  ok = (out == stdout ? std::fflush(out) : std::fclose(out)) == 0 && ok;
+  if (!ok) {
+    std::print(stderr, "Could not write {}.\n",
+               path.empty() ? "to stdout" : path);
+    return 1;
+  }
+  if (out != stdout) {
+    std::print(stderr, "Wrote {} ({} {}).\n", path, size, info.size_unit);
+  }
+  return 0;
+}
+
+}  // namespace aoc
@@ -0,0 +1,105 @@
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <format>
+#include <iterator>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace aoc {
+
+// Deterministic puzzle-input generators, for finding out how a day scales
+// past the size of its checked-in input.
+//
+// A generator is a binary next to its day, e.g. //2024:day1_gen:
+//
+//   void Generate(aoc::Generator& gen) {
+//     for (int64_t i = 0; i < gen.size(); ++i) {
+//       gen.Print("{}   {}\n", gen.Uniform(10000, 99999), ...);
+//     }
+//   }
+//
+//   int main(int argc, char** argv) {
+//     return aoc::RunGenerator(argc, argv, {.default_size = 1000,
+//                                           .size_unit = "lines"}, Generate);
+//   }
+//
+// Flags:
+//   --size=N       How big an input to make, in the generator's size_unit.
+//   --seed=N       The same seed and size always produce the same bytes.
+//   --output=PATH  Write to PATH instead of stdout.
+struct GeneratorInfo {
+  int64_t default_size = 0;
+  // What --size counts, e.g. "characters" or "rows and columns".
+  std::string_view size_unit;
+};
+
+class Generator {
+ public:
+  Generator(int64_t size, uint64_t seed, std::FILE* out)
+      : size_(size), rng_(seed), out_(out) {
+    buffer_.reserve(kBufferSize);
+  }
+  Generator(const Generator&) = delete;
+  Generator& operator=(const Generator&) = delete;
+  ~Generator() { Flush(); }
+
+  int64_t size() const { return size_; }
+
+  // Uniformly random in [lo, hi]. Unlike std::uniform_int_distribution, the
+  // sequence is the same with every standard library.
+  int64_t Uniform(int64_t lo, int64_t hi) {
+    return lo + static_cast<int64_t>(rng_() %
+                                     static_cast<uint64_t>(hi - lo + 1));
+  }
+  // True with probability `p`.
+  bool Chance(double p) { return (rng_() >> 11) * 0x1.0p-53 < p; }
+  // A random element of `options`.
+  char Pick(std::string_view options) {
+    return options[Uniform(0, options.size() - 1)];
+  }
+
+  template <typename T>
+  void Shuffle(std::vector<T>& values) {
+    for (int64_t i = static_cast<int64_t>(values.size()) - 1; i > 0; --i) {
+      std::swap(values[i], values[Uniform(0, i)]);
+    }
+  }
+
+  void Write(std::string_view text) {
+    buffer_.append(text);
+    if (buffer_.size() >= kBufferSize) Flush();
+  }
+  void Write(char c) {
+    buffer_.push_back(c);
+    if (buffer_.size() >= kBufferSize) Flush();
+  }
+  template <typename... Args>
+  void Print(std::format_string<Args...> format, Args&&... args) {
+    std::format_to(std::back_inserter(buffer_), format,
+                   std::forward<Args>(args)...);
+    if (buffer_.size() >= kBufferSize) Flush();
+  }
+
+  void Flush();
+  // True if writing any of the output failed.
+  bool failed() const { return failed_; }
+
+ private:
+  static constexpr size_t kBufferSize = 1 << 16;
+
+  int64_t size_;
+  std::mt19937_64 rng_;
+  std::FILE* out_;
+  std::string buffer_;
+  bool failed_ = false;
+};
+
+// Parses the flags and runs `generate`.
+int RunGenerator(int argc, char** argv, const GeneratorInfo& info,
+                 void (*generate)(Generator& gen));
+
+}  // namespace aoc
@@ -0,0 +1,193 @@
+// Compares the nested layout aoc::Map and aoc::VisitedMap used to have
+// (a std::vector<std::string> and a std::vector<std::vector<bool>>) against
+// the contiguous aoc::Grid they are built on now, on the two access patterns
+// the grid days use: a flood fill over regions (2024 day12) and a sweep that
+// reads every cell's eight neighbors (2015 day18).
+//
+// Prints time per pass and, where the kernel allows it, cycles and cache
+// misses from aoc::PerfCounters.
+//
+// Usage: bazel run -c opt //utils:grid_benchmark -- [size]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <print>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "utils/perf_counters.h"
+#include "utils/utils.h"
+
+namespace {
+
+constexpr int kRepetitions = 10;
+
+// Keeps the optimizer from throwing away the results.
+int64_t sink = 0;
+
+// Garden plots shaped like 2024 day12: a few letters in blobby regions.
+std::vector<std::string> MakeGarden(int size) {
+  std::mt19937 rng(12);
+  std::vector<std::string> rows(size, std::string(size, 'A'));
+  for (int row = 0; row < size; ++row) {
+    for (int col = 0; col < size; ++col) {
+      if (rng() % 4 != 0 && row > 0) {
+        rows[row][col] = rows[row - 1][col];
+      } else if (rng() % 4 != 0 && col > 0) {
+        rows[row][col] = rows[row][col - 1];
+      } else {
+        rows[row][col] = 'A' + rng() % 6;
+      }
+    }
+  }
+  return rows;
+}
+
+// The layout before aoc::Grid.
+class NestedMap {
+ public:
+  explicit NestedMap(const std::vector<std::string>& rows) : rows_(rows) {}
+
+  bool IsOutOfBounds(aoc::Coordinate c) const {
+    return c.row < 0 || c.row >= rows_.size() || c.col < 0 ||
+           c.col >= rows_[0].size();
+  }
+  char GetChar(aoc::Coordinate c) const {
+    return IsOutOfBounds(c) ? '\0' : rows_[c.row][c.col];
+  }
+  int64_t NumRows() const { return rows_.size(); }
+  int64_t NumCols() const { return rows_[0].size(); }
+
+ private:
+  std::vector<std::string> rows_;
+};
+
+class NestedVisitedMap {
+ public:
+  NestedVisitedMap(int rows, int cols)
+      : visited_(rows, std::vector<bool>(cols, false)) {}
+
+  void MarkVisited(aoc::Coordinate c) { visited_[c.row][c.col] = true; }
+  bool IsVisited(aoc::Coordinate c) const { return visited_[c.row][c.col]; }
+
+ private:
+  std::vector<std::vector<bool>> visited_;
+};
+
+// Sums area * perimeter over every region, like 2024 day12 part 1.
+template <typename MapT, typename VisitedT>
+int64_t FloodFillRegions(const MapT& map) {
+  VisitedT visited(map.NumRows(), map.NumCols());
+  std::vector<aoc::Coordinate> stack;
+  int64_t price = 0;
+  for (int row = 0; row < map.NumRows(); ++row) {
+    for (int col = 0; col < map.NumCols(); ++col) {
+      aoc::Coordinate start{row, col};
+      if (visited.IsVisited(start)) {
+        continue;
+      }
+      const char plant = map.GetChar(start);
+      int64_t area = 0;
+      int64_t perimeter = 0;
+      visited.MarkVisited(start);
+      stack.push_back(start);
+      while (!stack.empty()) {
+        aoc::Coordinate c = stack.back();
+        stack.pop_back();
+        ++area;
+        for (aoc::Coordinate next : {aoc::GoUp(c), aoc::GoDown(c),
+                                     aoc::GoLeft(c), aoc::GoRight(c)}) {
+          if (map.GetChar(next) != plant) {
+            ++perimeter;
+          } else if (!visited.IsVisited(next)) {
+            visited.MarkVisited(next);
+            stack.push_back(next);
+          }
+        }
+      }
+      price += area * perimeter;
+    }
+  }
+  return price;
+}
+
+// Counts cells with exactly three equal neighbors, like 2015 day18's step.
+template <typename MapT>
+int64_t NeighborSweep(const MapT& map) {
+  int64_t count = 0;
+  for (int row = 0; row < map.NumRows(); ++row) {
+    for (int col = 0; col < map.NumCols(); ++col) {
+      aoc::Coordinate c{row, col};
+      const char plant = map.GetChar(c);
+      int same = 0;
+      for (int dr = -1; dr <= 1; ++dr) {
+        for (int dc = -1; dc <= 1; ++dc) {
+          if (dr != 0 || dc != 0) {
+            same += map.GetChar({row + dr, col + dc}) == plant;
+          }
+        }
+      }
+      count += same == 3;
+    }
+  }
+  return count;
+}
+
+struct Result {
+  double ms_per_pass = 0;
+  aoc::PerfSample sample;
+};
+
+template <typename F>
+Result Measure(const std::string& name, aoc::PerfCounters& perf, F pass) {
+  sink += pass();  // Warm-up.
+  perf.Start();
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kRepetitions; ++i) {
+    sink += pass();
+  }
+  auto end = std::chrono::steady_clock::now();
+  aoc::PerfCounts counts = perf.Stop();
+  return {.ms_per_pass =
+              std::chrono::duration<double, std::milli>(end - start).count() /
+              kRepetitions,
+          .sample = {.name = name, .counts = counts}};
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const int size = argc > 1 ? std::atoi(argv[1]) : 2048;
+  std::vector<std::string> rows = MakeGarden(size);
+  NestedMap nested(rows);
+  aoc::Map grid(rows);
+
+  aoc::PerfCounters perf = aoc::PerfCounters::Open();
+  std::vector<Result> results = {
+      Measure("flood fill, nested", perf,
+              [&] {
+                return FloodFillRegions<NestedMap, NestedVisitedMap>(nested);
+              }),
+      Measure("flood fill, grid", perf,
+              [&] { return FloodFillRegions<aoc::Map, aoc::VisitedMap>(grid); }),
+      Measure("neighbors, nested", perf, [&] { return NeighborSweep(nested); }),
+      Measure("neighbors, grid", perf, [&] { return NeighborSweep(grid); }),
+  };
+
+  std::print("{}x{} garden, {} passes each.\n\n", size, size, kRepetitions);
+  std::print("{:<20} {:>10}\n", "", "ms/pass");
+  std::vector<aoc::PerfSample> samples;
+  for (const Result& result : results) {
+    std::print("{:<20} {:>10.2f}\n", result.sample.name, result.ms_per_pass);
+    samples.push_back(result.sample);
+  }
+  std::print("\n");
+  if (perf.status().ok()) {
+    PrintPerfTable(samples);
+  } else {
+    std::print("No hardware counters: {}\n", perf.status().ToString());
+  }
+  return sink == 42 ? 1 : 0;
+}
@@ -0,0 +1,211 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "utils/utils.h"
+
+namespace aoc {
+
+// The four orthogonal neighbors of a cell, clockwise from up.
+struct OrthogonalNeighbors {
+  std::array<Coordinate, 4> operator()(Coordinate c) const {
+    return {GoUp(c), GoRight(c), GoDown(c), GoLeft(c)};
+  }
+};
+
+// Non-recursive searches over a bounded grid.
+//
+// The grid itself is never stored; callers describe it through callbacks:
+//   can_step(from, to) -> bool               Whether `to` may follow `from`.
+//   cost(from, to) -> std::optional<int64_t> Cost of the step, or nullopt if
+//                                            it is not allowed.
+// `neighbors(c)` returns the candidate cells around `c` as any range of
+// Coordinates. Candidates that fall outside [0, rows) x [0, cols) are dropped
+// before any callback sees them.
+//
+// The frontier, visited and distance buffers belong to the GridSearch and are
+// reused from one call to the next, so running many searches over the same
+// grid (e.g. one per trailhead) doesn't allocate after the first.
+//
+// Usage:
+//   aoc::GridSearch search(map.NumRows(), map.NumCols());
+//   search.Bfs(start,
+//              [&](Coordinate from, Coordinate to) {
+//                return map.GetInt(to) == map.GetInt(from) + 1;
+//              },
+//              [&](Coordinate c, int64_t depth) { ... });
+template <typename Neighbors = OrthogonalNeighbors>
+class GridSearch {
+ public:
+  GridSearch(int64_t rows, int64_t cols, Neighbors neighbors = {})
+      : neighbors_(std::move(neighbors)),
+        visited_(rows, cols),
+        reached_(rows, cols),
+        distance_(rows, cols, 0) {}
+
+  // Calls visit(c, depth) once for every cell reachable from `start`, in
+  // breadth-first order. `depth` is the number of steps from `start`.
+  template <typename CanStep, typename Visit>
+  void Bfs(Coordinate start, CanStep can_step, Visit visit) {
+    visited_.Reset();
+    queue_.clear();
+    queue_.push_back({start, 0});
+    visited_.MarkVisited(start);
+    for (size_t head = 0; head < queue_.size(); ++head) {
+      auto [c, depth] = queue_[head];
+      visit(c, depth);
+      for (Coordinate next : neighbors_(c)) {
+        if (visited_.IsOutOfBounds(next) || visited_.IsVisited(next) ||
+            !can_step(c, next)) {
+          continue;
+        }
+        visited_.MarkVisited(next);
+        queue_.push_back({next, depth + 1});
+      }
+    }
+  }
+
+  // Calls visit(c) once for every cell reachable from `start`, in depth-first
+  // preorder. Neighbors are explored in the order `neighbors` returns them, so
+  // cells are visited in exactly the order a recursive flood fill that marks
+  // each cell on entry would visit them. visit() may look at which cells have
+  // been visited so far through IsVisited().
+  template <typename CanStep, typename Visit>
+  void Dfs(Coordinate start, CanStep can_step, Visit visit) {
+    visited_.Reset();
+    stack_.clear();
+    stack_.push_back(start);
+    while (!stack_.empty()) {
+      Coordinate c = stack_.back();
+      stack_.pop_back();
+      if (visited_.IsVisited(c)) {
+        continue;
+      }
+      visited_.MarkVisited(c);
+      visit(c);
+      auto next_cells = neighbors_(c);
+      // Push in reverse so the first neighbor is popped first.
+      for (auto it = std::rbegin(next_cells); it != std::rend(next_cells);
+           ++it) {
+        if (!visited_.IsOutOfBounds(*it) && !visited_.IsVisited(*it) &&
+            can_step(c, *it)) {
+          stack_.push_back(*it);
+        }
+      }
+    }
+  }
+
+  // Calls visit(c) once per distinct path from `start` to `c`. No cell is
+  // marked visited, so the step graph must be acyclic (e.g. heights that
+  // strictly increase); the work is proportional to the number of paths.
+  template <typename CanStep, typename Visit>
+  void ForEachPath(Coordinate start, CanStep can_step, Visit visit) {
+    stack_.clear();
+    stack_.push_back(start);
+    while (!stack_.empty()) {
+      Coordinate c = stack_.back();
+      stack_.pop_back();
+      visit(c);
+      for (Coordinate next : neighbors_(c)) {
+        if (!visited_.IsOutOfBounds(next) && can_step(c, next)) {
+          stack_.push_back(next);
+        }
+      }
+    }
+  }
+
+  // Dijkstra's algorithm from `start` to the first cell for which is_goal(c)
+  // is true. Returns the cost of the cheapest path, or std::nullopt if no goal
+  // is reachable. Step costs must be non-negative.
+  template <typename Cost, typename IsGoal>
+  std::optional<int64_t> ShortestPath(Coordinate start, Cost cost,
+                                      IsGoal is_goal) {
+    return AStar(start, std::move(cost), std::move(is_goal),
+                 [](Coordinate) { return int64_t{0}; });
+  }
+
+  // A* search. `heuristic(c)` must never overestimate the remaining cost to a
+  // goal, or the returned cost may not be the cheapest.
+  template <typename Cost, typename IsGoal, typename Heuristic>
+  std::optional<int64_t> AStar(Coordinate start, Cost cost, IsGoal is_goal,
+                               Heuristic heuristic) {
+    visited_.Reset();
+    reached_.Reset();
+    heap_.clear();
+    Relax(start, 0, heuristic);
+    while (!heap_.empty()) {
+      std::pop_heap(heap_.begin(), heap_.end(), std::greater<>());
+      auto [priority, distance, c] = heap_.back();
+      heap_.pop_back();
+      if (visited_.IsVisited(c) || distance != distance_[c]) {
+        continue;  // Stale entry: a cheaper path was found after this push.
+      }
+      visited_.MarkVisited(c);
+      if (is_goal(c)) {
+        return distance;
+      }
+      for (Coordinate next : neighbors_(c)) {
+        if (visited_.IsOutOfBounds(next) || visited_.IsVisited(next)) {
+          continue;
+        }
+        std::optional<int64_t> step = cost(c, next);
+        if (step.has_value()) {
+          Relax(next, distance + *step, heuristic);
+        }
+      }
+    }
+    return std::nullopt;
+  }
+
+  // Whether `c` was visited by the last search.
+  bool IsVisited(Coordinate c) const { return visited_.IsVisited(c); }
+
+  // The best known cost to `c` from the last ShortestPath()/AStar(), or
+  // std::nullopt if the search never reached it.
+  std::optional<int64_t> Distance(Coordinate c) const {
+    if (!reached_.IsVisited(c)) {
+      return std::nullopt;
+    }
+    return distance_[c];
+  }
+
+ private:
+  struct HeapEntry {
+    int64_t priority;
+    int64_t distance;
+    Coordinate c;
+
+    bool operator>(const HeapEntry& other) const {
+      return priority > other.priority;
+    }
+  };
+
+  template <typename Heuristic>
+  void Relax(Coordinate c, int64_t distance, Heuristic& heuristic) {
+    if (reached_.IsVisited(c) && distance_[c] <= distance) {
+      return;
+    }
+    reached_.MarkVisited(c);
+    distance_[c] = distance;
+    heap_.push_back({distance + heuristic(c), distance, c});
+    std::push_heap(heap_.begin(), heap_.end(), std::greater<>());
+  }
+
+  Neighbors neighbors_;
+  // Settled (Dijkstra/A*) or discovered (BFS/DFS) cells.
+  EpochVisitedMap visited_;
+  // Cells with a valid entry in distance_.
+  EpochVisitedMap reached_;
+  Grid<int64_t> distance_;
+
+  std::vector<std::pair<Coordinate, int64_t>> queue_;
+  std::vector<Coordinate> stack_;
+  std::vector<HeapEntry> heap_;
+};
+
+}  // namespace aoc
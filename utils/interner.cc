@@ -0,0 +1,107 @@
+#include "utils/interner.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "utils/arena.h"
+
+namespace aoc {
+
+namespace {
+
+// Names are short, so the arena starts small.
+constexpr size_t kArenaSize = 4 << 10;
+
+// Seeds to try at each table size before doubling it.
+constexpr int kSeedsPerSize = 64;
+
+// FNV-1a, seeded, with a final mix so the low bits depend on every byte.
+uint64_t Hash(std::string_view name, uint64_t seed) {
+  uint64_t h = 0xcbf29ce484222325 ^ seed;
+  for (char c : name) {
+    h ^= static_cast<unsigned char>(c);
+    h *= 0x100000001b3;
+  }
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccd;
+  h ^= h >> 33;
+  return h;
+}
+
+}  // namespace
+
+Interner::Interner() : arena_(std::make_unique<Arena>(kArenaSize)) {}
+
+int Interner::Intern(std::string_view name) {
+  if (frozen()) {
+    std::optional<int> id = Find(name);
+    CHECK(id.has_value()) << "\"" << name << "\" is not in a frozen Interner";
+    return *id;
+  }
+  auto it = ids_.find(name);
+  if (it != ids_.end()) {
+    return it->second;
+  }
+  char* copy = static_cast<char*>(arena_->resource()->allocate(
+      std::max<size_t>(name.size(), 1), alignof(char)));
+  std::memcpy(copy, name.data(), name.size());
+  std::string_view stored(copy, name.size());
+  int id = size();
+  names_.push_back(stored);
+  ids_.emplace(stored, id);
+  return id;
+}
+
+std::optional<int> Interner::Find(std::string_view name) const {
+  if (frozen()) {
+    int id = slots_[Slot(name)];
+    if (id < 0 || names_[id] != name) {
+      return std::nullopt;
+    }
+    return id;
+  }
+  auto it = ids_.find(name);
+  if (it == ids_.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+void Interner::Freeze() {
+  if (frozen()) {
+    return;
+  }
+  // A random function into n^2 slots is collision-free more often than not,
+  // so this stops by then at the latest.
+  for (size_t table_size = std::bit_ceil(names_.size() + 1);;
+       table_size *= 2) {
+    slots_.assign(table_size, -1);
+    for (seed_ = 1; seed_ <= kSeedsPerSize; ++seed_) {
+      bool collided = false;
+      for (int id = 0; id < size() && !collided; ++id) {
+        int& slot = slots_[Slot(names_[id])];
+        collided = slot >= 0;
+        slot = id;
+      }
+      if (!collided) {
+        ids_ = {};
+        return;
+      }
+      std::fill(slots_.begin(), slots_.end(), -1);
+    }
+  }
+}
+
+size_t Interner::Slot(std::string_view name) const {
+  return Hash(name, seed_) & (slots_.size() - 1);
+}
+
+}  // namespace aoc
@@ -0,0 +1,67 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "utils/arena.h"
+
+namespace aoc {
+
+// Maps names to dense ids 0, 1, 2, ... in the order they were first seen, so
+// that anything keyed by a name can be a vector indexed by its id instead.
+//
+// Usage:
+//   aoc::Interner wires;
+//   int a = wires.Intern("a");   // 0
+//   int b = wires.Intern("b");   // 1
+//   wires.Intern("a");           // 0 again
+//   wires.Name(b);               // "b"
+//
+// The names themselves are copied into an arena, so the views returned by
+// Name() stay valid for as long as the Interner does, even if it is moved.
+//
+// Freeze() closes the vocabulary and replaces the hash map with a perfect hash
+// over the names seen so far: a lookup is one hash and one string compare.
+// Meant for small, fixed sets such as the property names in a puzzle.
+//
+// Not thread-safe.
+class Interner {
+ public:
+  Interner();
+  Interner(Interner&&) = default;
+  Interner& operator=(Interner&&) = default;
+  Interner(const Interner&) = delete;
+  Interner& operator=(const Interner&) = delete;
+
+  // The id of `name`, adding it if it is new. A frozen Interner can't add
+  // names: interning an unknown one is a CHECK failure.
+  int Intern(std::string_view name);
+
+  // The id of `name`, or nullopt if it was never interned.
+  std::optional<int> Find(std::string_view name) const;
+
+  std::string_view Name(int id) const { return names_[id]; }
+  int size() const { return static_cast<int>(names_.size()); }
+
+  // Switches to the perfect hash. Interning after this only finds names.
+  void Freeze();
+  bool frozen() const { return !slots_.empty(); }
+
+ private:
+  // The perfect hash's slot for `name`.
+  size_t Slot(std::string_view name) const;
+
+  std::unique_ptr<Arena> arena_;
+  std::vector<std::string_view> names_;
+  absl::flat_hash_map<std::string_view, int> ids_;
+
+  // Set by Freeze(). slots_[Slot(name)] is name's id, or -1.
+  std::vector<int> slots_;
+  uint64_t seed_ = 0;
+};
+
+}  // namespace aoc
@@ -0,0 +1,135 @@
+#include "utils/line_stream.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+
+namespace aoc {
+
+absl::StatusOr<LineStream> LineStream::Open(const std::string& path,
+                                            size_t buffer_size) {
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return absl::NotFoundError("Failed to open file " + path + ": " +
+                               std::strerror(errno));
+  }
+  // We read inputs front to back.
+  ::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+  return LineStream(fd, buffer_size);
+}
+
+LineStream::LineStream(int fd, size_t buffer_size)
+    : fd_(fd), capacity_(std::max<size_t>(buffer_size, 1)) {
+  buffer_ = std::make_unique<char[]>(capacity_);
+}
+
+LineStream::LineStream(LineStream&& other) noexcept
+    : memory_(std::exchange(other.memory_, std::nullopt)),
+      fd_(std::exchange(other.fd_, -1)),
+      buffer_(std::move(other.buffer_)),
+      capacity_(std::exchange(other.capacity_, 0)),
+      begin_(std::exchange(other.begin_, 0)),
+      scanned_(std::exchange(other.scanned_, 0)),
+      end_(std::exchange(other.end_, 0)),
+      eof_(std::exchange(other.eof_, false)),
+      status_(std::move(other.status_)) {}
+
+LineStream& LineStream::operator=(LineStream&& other) noexcept {
+  if (this != &other) {
+    Close();
+    memory_ = std::exchange(other.memory_, std::nullopt);
+    fd_ = std::exchange(other.fd_, -1);
+    buffer_ = std::move(other.buffer_);
+    capacity_ = std::exchange(other.capacity_, 0);
+    begin_ = std::exchange(other.begin_, 0);
+    scanned_ = std::exchange(other.scanned_, 0);
+    end_ = std::exchange(other.end_, 0);
+    eof_ = std::exchange(other.eof_, false);
+    status_ = std::move(other.status_);
+  }
+  return *this;
+}
+
+LineStream::~LineStream() { Close(); }
+
+void LineStream::Close() {
+  if (fd_ >= 0) {
+    ::close(fd_);
+    fd_ = -1;
+  }
+}
+
+std::optional<std::string_view> LineStream::Next() {
+  if (memory_.has_value()) {
+    std::string_view& rest = *memory_;
+    if (rest.empty()) return std::nullopt;
+    size_t newline = rest.find('\n');
+    std::string_view line = rest.substr(0, newline);
+    rest.remove_prefix(newline == std::string_view::npos ? rest.size()
+                                                         : newline + 1);
+    return line;
+  }
+
+  while (true) {
+    const void* newline =
+        std::memchr(buffer_.get() + scanned_, '\n', end_ - scanned_);
+    if (newline != nullptr) {
+      const size_t at = static_cast<const char*>(newline) - buffer_.get();
+      std::string_view line(buffer_.get() + begin_, at - begin_);
+      begin_ = scanned_ = at + 1;
+      return line;
+    }
+    scanned_ = end_;
+    if (!Fill()) break;
+  }
+  // The last line has no '\n'.
+  if (begin_ == end_ || !status_.ok()) return std::nullopt;
+  std::string_view line(buffer_.get() + begin_, end_ - begin_);
+  begin_ = scanned_ = end_;
+  return line;
+}
+
+bool LineStream::Fill() {
+  if (eof_) return false;
+  if (begin_ > 0) {
+    std::memmove(buffer_.get(), buffer_.get() + begin_, end_ - begin_);
+    end_ -= begin_;
+    scanned_ -= begin_;
+    begin_ = 0;
+  }
+  if (end_ == capacity_) {
+    // One line fills the whole buffer.
+    auto bigger = std::make_unique<char[]>(capacity_ * 2);
+    std::memcpy(bigger.get(), buffer_.get(), end_);
+    buffer_ = std::move(bigger);
+    capacity_ *= 2;
+  }
+  while (true) {
+    ssize_t n = ::read(fd_, buffer_.get() + end_, capacity_ - end_);
+    if (n > 0) {
+      end_ += n;
+      return true;
+    }
+    if (n < 0 && errno == EINTR) continue;
+    if (n < 0) {
+      status_ = absl::DataLossError(std::string("Failed to read input: ") +
+                                    std::strerror(errno));
+    }
+    eof_ = true;
+    Close();
+    return false;
+  }
+}
+
+}  // namespace aoc
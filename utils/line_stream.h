@@ -0,0 +1,77 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+
+namespace aoc {
+
+// Reads a file one line at a time with read(2) into a fixed-size buffer, so
+// a day that only needs one line at a time can solve an input of any size in
+// constant memory.
+//
+// Usage:
+//   absl::StatusOr<aoc::LineStream> lines = aoc::LineStream::Open(path);
+//   CHECK_OK(lines);
+//   while (std::optional<std::string_view> line = lines->Next()) { ... }
+//   CHECK_OK(lines->status());
+//
+// Lines are split like SplitLines(): no '\n', no trimming, and no empty line
+// for a trailing '\n'. A line that does not fit in the buffer grows it, so
+// memory is bounded by the longest line rather than by the file.
+//
+// A LineStream can also walk an input that is already in memory, in which
+// case nothing is copied. Days whose Parse takes a LineStream& (see
+// utils/day.h) get both for free.
+class LineStream {
+ public:
+  static constexpr size_t kDefaultBufferSize = size_t{1} << 16;
+
+  // Streams the file at `path`.
+  static absl::StatusOr<LineStream> Open(
+      const std::string& path, size_t buffer_size = kDefaultBufferSize);
+
+  // Streams `input`, which must outlive the LineStream.
+  explicit LineStream(std::string_view input) : memory_(input) {}
+
+  LineStream(LineStream&& other) noexcept;
+  LineStream& operator=(LineStream&& other) noexcept;
+  LineStream(const LineStream&) = delete;
+  LineStream& operator=(const LineStream&) = delete;
+  ~LineStream();
+
+  // The next line, or nullopt at the end of the input or if a read failed.
+  // The view is only valid until the next call.
+  std::optional<std::string_view> Next();
+
+  // Why Next() stopped early, if it did.
+  const absl::Status& status() const { return status_; }
+
+ private:
+  LineStream(int fd, size_t buffer_size);
+
+  // Reads more of the file into the buffer, first moving the unread bytes to
+  // the front of it. Returns false at the end of the file or on an error.
+  bool Fill();
+  void Close();
+
+  // Set when streaming an in-memory input.
+  std::optional<std::string_view> memory_;
+
+  int fd_ = -1;
+  std::unique_ptr<char[]> buffer_;
+  size_t capacity_ = 0;
+  // Unread bytes are [begin_, end_). Everything in [begin_, scanned_) is known
+  // not to contain a '\n'.
+  size_t begin_ = 0;
+  size_t scanned_ = 0;
+  size_t end_ = 0;
+  bool eof_ = false;
+  absl::Status status_;
+};
+
+}  // namespace aoc
@@ -0,0 +1,99 @@
+#include "utils/mapped_input.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+
+namespace aoc {
+
+absl::StatusOr<MappedInput> MappedInput::Open(const std::string& file_path) {
+  int fd = ::open(file_path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return absl::NotFoundError("Failed to open file " + file_path + ": " +
+                               std::strerror(errno));
+  }
+
+  struct stat file_stat;
+  if (::fstat(fd, &file_stat) != 0) {
+    ::close(fd);
+    return absl::InternalError("Failed to stat file " + file_path);
+  }
+
+  size_t size = static_cast<size_t>(file_stat.st_size);
+  if (size == 0) {
+    // mmap refuses zero length mappings. An empty file is just empty.
+    ::close(fd);
+    return MappedInput(nullptr, 0);
+  }
+
+  void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping stays valid after the descriptor is closed.
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    return absl::InternalError("Failed to mmap file " + file_path);
+  }
+  // We read inputs front to back.
+  ::madvise(data, size, MADV_SEQUENTIAL);
+
+  return MappedInput(static_cast<const char*>(data), size);
+}
+
+MappedInput::MappedInput(MappedInput&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      lines_(std::move(other.lines_)),
+      lines_built_(std::exchange(other.lines_built_, false)) {}
+
+MappedInput& MappedInput::operator=(MappedInput&& other) noexcept {
+  if (this != &other) {
+    Unmap();
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    lines_ = std::move(other.lines_);
+    lines_built_ = std::exchange(other.lines_built_, false);
+  }
+  return *this;
+}
+
+MappedInput::~MappedInput() { Unmap(); }
+
+void MappedInput::Unmap() {
+  if (data_ != nullptr) {
+    ::munmap(const_cast<char*>(data_), size_);
+  }
+  data_ = nullptr;
+  size_ = 0;
+}
+
+const std::vector<std::string_view>& MappedInput::Lines() const {
+  if (lines_built_) {
+    return lines_;
+  }
+  lines_built_ = true;
+
+  std::string_view remaining = Contents();
+  while (!remaining.empty()) {
+    size_t pos = remaining.find('\n');
+    if (pos == std::string_view::npos) {
+      // Last line with no trailing newline.
+      lines_.push_back(remaining);
+      break;
+    }
+    lines_.push_back(remaining.substr(0, pos));
+    remaining.remove_prefix(pos + 1);
+  }
+  return lines_;
+}
+
+}  // namespace aoc
@@ -0,0 +1,58 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "absl/status/statusor.h"
+
+namespace aoc {
+
+// A read-only, memory-mapped view of an input file.
+//
+// The file contents are exposed directly as a std::string_view, so no copy of
+// the input is ever made. Lines() lazily builds an index of std::string_views
+// into the mapping the first time it is called.
+//
+// Usage:
+//   absl::StatusOr<aoc::MappedInput> input =
+//       aoc::MappedInput::Open("./2024/day1.txt");
+//   CHECK_OK(input);
+//   for (std::string_view line : input->Lines()) { ... }
+//
+// Every string_view handed out is only valid while the MappedInput is alive.
+class MappedInput {
+ public:
+  // Maps the file at `file_path` into memory.
+  static absl::StatusOr<MappedInput> Open(const std::string& file_path);
+
+  MappedInput(MappedInput&& other) noexcept;
+  MappedInput& operator=(MappedInput&& other) noexcept;
+  MappedInput(const MappedInput&) = delete;
+  MappedInput& operator=(const MappedInput&) = delete;
+  ~MappedInput();
+
+  // The entire file.
+  std::string_view Contents() const { return {data_, size_}; }
+
+  // The file split on '\n', with the same semantics as std::getline: the
+  // newline is not included and a trailing newline does not produce an empty
+  // final line.
+  const std::vector<std::string_view>& Lines() const;
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+ private:
+  MappedInput(const char* data, size_t size) : data_(data), size_(size) {}
+
+  void Unmap();
+
+  const char* data_ = nullptr;
+  size_t size_ = 0;
+  // Built on the first call to Lines().
+  mutable std::vector<std::string_view> lines_;
+  mutable bool lines_built_ = false;
+};
+
+}  // namespace aoc
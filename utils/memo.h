@@ -0,0 +1,167 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/hash/hash.h"
+#include "absl/synchronization/mutex.h"
+
+namespace aoc {
+
+struct MemoOptions {
+  // Most entries to keep. When full, the least recently used entry is evicted.
+  // 0 keeps everything.
+  size_t capacity = 0;
+  // 0 for a memo used by one thread at a time, with no locking. Otherwise the
+  // keys are split across this many independently locked shards, so threads
+  // can share the memo. A capacity is split evenly across the shards.
+  int shards = 0;
+};
+
+struct MemoStats {
+  int64_t hits = 0;
+  int64_t misses = 0;
+  int64_t evictions = 0;
+  int64_t size = 0;
+};
+
+// Caches the results of a pure function of `Key`.
+//
+// Usage:
+//   aoc::Memo<int64_t, int64_t> memo;
+//   int64_t Fib(int64_t n) {
+//     return memo.GetOrCompute(n, [](int64_t n) {
+//       return n < 2 ? n : Fib(n - 1) + Fib(n - 2);
+//     });
+//   }
+//   AOC_LOG(DEBUG, "{} hits, {} misses", memo.Stats().hits,
+//           memo.Stats().misses);
+//
+// `compute` runs without any lock held, so it may recurse into the memo. Two
+// threads that miss on the same key at once both compute it; the first result
+// stored wins.
+template <typename Key, typename Value, typename Hash = absl::Hash<Key>>
+class Memo {
+ public:
+  explicit Memo(MemoOptions options = {}) : options_(options) {
+    const int num_shards = std::max(options.shards, 1);
+    for (int i = 0; i < num_shards; ++i) {
+      shards_.push_back(std::make_unique<Shard>());
+    }
+    if (options.capacity > 0) {
+      shard_capacity_ = std::max<size_t>(options.capacity / num_shards, 1);
+    }
+  }
+
+  // The memoized value for `key`, calling compute(key) to make it on a miss.
+  template <typename F>
+  Value GetOrCompute(const Key& key, F&& compute) {
+    const size_t hash = hasher_(key);
+    if (std::optional<Value> value = Lookup(key, hash)) {
+      return *std::move(value);
+    }
+    Value value = compute(key);
+    Store(key, hash, value);
+    return value;
+  }
+
+  // The memoized value for `key`, if there is one. Counts as a hit or a miss.
+  std::optional<Value> Find(const Key& key) {
+    return Lookup(key, hasher_(key));
+  }
+
+  void Insert(const Key& key, Value value) {
+    Store(key, hasher_(key), std::move(value));
+  }
+
+  // Drops every entry. The counters are kept.
+  void Clear() {
+    for (auto& shard : shards_) {
+      absl::MutexLockMaybe lock(MutexFor(*shard));
+      shard->entries.clear();
+      shard->lru.clear();
+    }
+  }
+
+  MemoStats Stats() const {
+    MemoStats stats;
+    for (const auto& shard : shards_) {
+      absl::MutexLockMaybe lock(MutexFor(*shard));
+      stats.hits += shard->stats.hits;
+      stats.misses += shard->stats.misses;
+      stats.evictions += shard->stats.evictions;
+      stats.size += shard->entries.size();
+    }
+    return stats;
+  }
+
+ private:
+  struct Entry {
+    Value value;
+    // Where the key sits in Shard::lru. Unused without a capacity.
+    typename std::list<Key>::iterator lru;
+  };
+
+  // Everything but `mu` is guarded by `mu` when the memo is sharded. It is
+  // not annotated, since an unsharded memo never locks it.
+  struct Shard {
+    absl::Mutex mu;
+    absl::flat_hash_map<Key, Entry, Hash> entries;
+    // Most recently used first. Empty without a capacity.
+    std::list<Key> lru;
+    MemoStats stats;
+  };
+
+  Shard& ShardFor(size_t hash) {
+    // The hash map indexes by the low bits, so pick shards by the high ones.
+    return *shards_[(static_cast<uint64_t>(hash) >> 32) % shards_.size()];
+  }
+
+  absl::Mutex* MutexFor(Shard& shard) const {
+    return options_.shards > 0 ? &shard.mu : nullptr;
+  }
+
+  std::optional<Value> Lookup(const Key& key, size_t hash) {
+    Shard& shard = ShardFor(hash);
+    absl::MutexLockMaybe lock(MutexFor(shard));
+    auto it = shard.entries.find(key);
+    if (it == shard.entries.end()) {
+      ++shard.stats.misses;
+      return std::nullopt;
+    }
+    ++shard.stats.hits;
+    if (shard_capacity_ > 0) {
+      shard.lru.splice(shard.lru.begin(), shard.lru, it->second.lru);
+    }
+    return it->second.value;
+  }
+
+  void Store(const Key& key, size_t hash, Value value) {
+    Shard& shard = ShardFor(hash);
+    absl::MutexLockMaybe lock(MutexFor(shard));
+    auto [it, inserted] = shard.entries.try_emplace(key, std::move(value));
+    if (!inserted || shard_capacity_ == 0) {
+      return;
+    }
+    shard.lru.push_front(key);
+    it->second.lru = shard.lru.begin();
+    if (shard.entries.size() > shard_capacity_) {
+      shard.entries.erase(shard.lru.back());
+      shard.lru.pop_back();
+      ++shard.stats.evictions;
+    }
+  }
+
+  MemoOptions options_;
+  size_t shard_capacity_ = 0;
+  Hash hasher_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+}  // namespace aoc
@@ -0,0 +1,187 @@
+#include "utils/perf_counters.h"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <optional>
+#include <print>
+#include <span>
+#include <string>
+#include <utility>
+
+#include "absl/status/status.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif
+
+namespace aoc {
+namespace {
+
+std::string FormatCount(std::optional<int64_t> count) {
+  if (!count.has_value()) return "n/a";
+  double value = *count;
+  if (value < 1e4) return std::format("{}", *count);
+  if (value < 1e7) return std::format("{:.1f}k", value / 1e3);
+  if (value < 1e10) return std::format("{:.1f}M", value / 1e6);
+  return std::format("{:.1f}G", value / 1e9);
+}
+
+#if defined(__linux__)
+
+struct CounterConfig {
+  uint32_t type;
+  uint64_t config;
+  const char* name;
+};
+
+// In the order of PerfCounts' fields.
+constexpr std::array<CounterConfig, 5> kCounters = {{
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, "cycles"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, "instructions"},
+    {PERF_TYPE_HW_CACHE,
+     PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+         (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+     "L1d read misses"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, "cache misses"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, "branch misses"},
+}};
+
+int OpenCounter(const CounterConfig& counter) {
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = counter.type;
+  attr.config = counter.config;
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format =
+      PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return syscall(SYS_perf_event_open, &attr, /*pid=*/0, /*cpu=*/-1,
+                 /*group_fd=*/-1, /*flags=*/0);
+}
+
+std::optional<int64_t> ReadCounter(int fd) {
+  if (fd < 0) return std::nullopt;
+  struct {
+    uint64_t value;
+    uint64_t time_enabled;
+    uint64_t time_running;
+  } data;
+  if (read(fd, &data, sizeof(data)) != sizeof(data) ||
+      data.time_running == 0) {
+    return std::nullopt;
+  }
+  // The counter only ran for part of the time if the PMU was shared.
+  return static_cast<int64_t>(static_cast<double>(data.value) *
+                              data.time_enabled / data.time_running);
+}
+
+#endif  // defined(__linux__)
+
+}  // namespace
+
+std::optional<double> PerfCounts::Ipc() const {
+  if (!cycles.has_value() || !instructions.has_value() || *cycles == 0) {
+    return std::nullopt;
+  }
+  return static_cast<double>(*instructions) / *cycles;
+}
+
+PerfCounters::PerfCounters(PerfCounters&& other) noexcept
+    : fds_(std::exchange(other.fds_, {-1, -1, -1, -1, -1})),
+      status_(std::move(other.status_)) {}
+
+PerfCounters& PerfCounters::operator=(PerfCounters&& other) noexcept {
+  if (this != &other) {
+    Close();
+    fds_ = std::exchange(other.fds_, {-1, -1, -1, -1, -1});
+    status_ = std::move(other.status_);
+  }
+  return *this;
+}
+
+PerfCounters::~PerfCounters() { Close(); }
+
+void PerfCounters::Close() {
+#if defined(__linux__)
+  for (int& fd : fds_) {
+    if (fd >= 0) close(fd);
+    fd = -1;
+  }
+#endif
+}
+
+PerfCounters PerfCounters::Open() {
+  PerfCounters counters;
+#if defined(__linux__)
+  absl::Status first_error;
+  for (int i = 0; i < kNumCounters; ++i) {
+    counters.fds_[i] = OpenCounter(kCounters[i]);
+    if (counters.fds_[i] < 0 && first_error.ok()) {
+      first_error = absl::UnavailableError(
+          std::format("perf_event_open({}): {}", kCounters[i].name,
+                      std::strerror(errno)));
+    }
+  }
+  bool any_open = false;
+  for (int fd : counters.fds_) {
+    any_open |= fd >= 0;
+  }
+  counters.status_ = any_open ? absl::OkStatus() : first_error;
+#else
+  counters.status_ =
+      absl::UnimplementedError("Hardware counters need perf_event_open.");
+#endif
+  return counters;
+}
+
+void PerfCounters::Start() {
+#if defined(__linux__)
+  for (int fd : fds_) {
+    if (fd < 0) continue;
+    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+  }
+#endif
+}
+
+PerfCounts PerfCounters::Stop() {
+#if defined(__linux__)
+  for (int fd : fds_) {
+    if (fd >= 0) ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+  }
+  return {
+      .cycles = ReadCounter(fds_[0]),
+      .instructions = ReadCounter(fds_[1]),
+      .l1d_misses = ReadCounter(fds_[2]),
+      .llc_misses = ReadCounter(fds_[3]),
+      .branch_misses = ReadCounter(fds_[4]),
+  };
+#else
+  return {};
+#endif
+}
+
+void PrintPerfTable(std::span<const PerfSample> samples) {
+  std::print("{:<16} {:>10} {:>10} {:>6} {:>10} {:>10} {:>10}\n", "phase",
+             "cycles", "instrs", "IPC", "L1d miss", "LLC miss", "br miss");
+  for (const PerfSample& sample : samples) {
+    const PerfCounts& c = sample.counts;
+    std::optional<double> ipc = c.Ipc();
+    std::print("{:<16} {:>10} {:>10} {:>6} {:>10} {:>10} {:>10}\n",
+               sample.name, FormatCount(c.cycles), FormatCount(c.instructions),
+               ipc.has_value() ? std::format("{:.2f}", *ipc) : "n/a",
+               FormatCount(c.l1d_misses), FormatCount(c.llc_misses),
+               FormatCount(c.branch_misses));
+  }
+}
+
+}  // namespace aoc
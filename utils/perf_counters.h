@@ -0,0 +1,77 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+
+#include "absl/status/status.h"
+
+namespace aoc {
+
+// Hardware performance counters for a region of code, read through Linux
+// perf_event_open.
+//
+// Usage:
+//   aoc::PerfCounters perf = aoc::PerfCounters::Open();
+//   perf.Start();
+//   ComputeRegion(...);
+//   aoc::PerfCounts counts = perf.Stop();
+//
+// Counters only count the calling thread, in user space. Any counter the
+// kernel refuses (no PMU in a VM or container, perf_event_paranoid, not
+// Linux) is left unset rather than failing, so callers can always measure
+// and print whatever is available.
+struct PerfCounts {
+  // Unset when the counter is unavailable.
+  std::optional<int64_t> cycles;
+  std::optional<int64_t> instructions;
+  std::optional<int64_t> l1d_misses;
+  std::optional<int64_t> llc_misses;
+  std::optional<int64_t> branch_misses;
+
+  // Instructions per cycle, if both were counted.
+  std::optional<double> Ipc() const;
+};
+
+class PerfCounters {
+ public:
+  // No counters; Stop() returns an empty PerfCounts.
+  PerfCounters() = default;
+  PerfCounters(PerfCounters&& other) noexcept;
+  PerfCounters& operator=(PerfCounters&& other) noexcept;
+  ~PerfCounters();
+
+  // Opens every counter the kernel allows for the calling thread.
+  static PerfCounters Open();
+
+  // Ok if at least one counter opened, otherwise why the first one failed.
+  const absl::Status& status() const { return status_; }
+
+  // Zeroes and starts the counters.
+  void Start();
+  // Stops the counters and reads them. Counts are scaled up if the kernel had
+  // to multiplex the counters.
+  PerfCounts Stop();
+
+ private:
+  static constexpr int kNumCounters = 5;
+
+  void Close();
+
+  // -1 for counters that did not open.
+  std::array<int, kNumCounters> fds_ = {-1, -1, -1, -1, -1};
+  absl::Status status_ = absl::UnavailableError("Counters not opened");
+};
+
+// Counts for one named phase of a run.
+struct PerfSample {
+  std::string name;
+  PerfCounts counts;
+};
+
+// Prints one row per sample: cycles, instructions, IPC, L1d and LLC misses
+// and branch misses, with "n/a" for counters that were unavailable.
+void PrintPerfTable(std::span<const PerfSample> samples);
+
+}  // namespace aoc
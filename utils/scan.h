@@ -0,0 +1,140 @@
+#pragma once
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace aoc {
+
+// A string literal usable as a template argument.
+template <size_t N>
+struct FixedString {
+  char data[N]{};
+
+  constexpr FixedString(const char (&str)[N]) {
+    for (size_t i = 0; i < N; ++i) {
+      data[i] = str[i];
+    }
+  }
+
+  constexpr std::string_view view() const { return {data, N - 1}; }
+};
+
+namespace scan_internal {
+
+// Number of "{}" placeholders in the pattern.
+constexpr size_t CountFields(std::string_view pattern) {
+  size_t count = 0;
+  for (size_t pos = pattern.find("{}"); pos != std::string_view::npos;
+       pos = pattern.find("{}", pos + 2)) {
+    ++count;
+  }
+  return count;
+}
+
+// The literal text around the placeholders: literals[i] precedes field i and
+// literals[kNumFields] trails the last field.
+template <FixedString kPattern>
+constexpr auto SplitLiterals() {
+  constexpr std::string_view pattern = kPattern.view();
+  std::array<std::string_view, CountFields(pattern) + 1> literals;
+  size_t start = 0;
+  for (size_t i = 0; i + 1 < literals.size(); ++i) {
+    size_t pos = pattern.find("{}", start);
+    literals[i] = pattern.substr(start, pos - start);
+    start = pos + 2;
+  }
+  literals.back() = pattern.substr(start);
+  return literals;
+}
+
+template <typename T>
+bool ParseField(std::string_view text, T& out) {
+  if constexpr (std::is_same_v<T, std::string_view>) {
+    out = text;
+    return true;
+  } else if constexpr (std::is_same_v<T, char>) {
+    if (text.size() != 1) return false;
+    out = text.front();
+    return true;
+  } else {
+    static_assert(std::is_integral_v<T>, "Scan fields must be integers, "
+                                         "char or std::string_view.");
+    // from_chars does not accept a leading '+', but AoC inputs use them.
+    if (!text.empty() && text.front() == '+') {
+      text.remove_prefix(1);
+    }
+    const char* end = text.data() + text.size();
+    auto [ptr, ec] = std::from_chars(text.data(), end, out);
+    return ec == std::errc() && ptr == end;
+  }
+}
+
+}  // namespace scan_internal
+
+// Matches `input` against a pattern of literal text and "{}" placeholders and
+// returns the placeholders converted to Ts. The pattern is split at compile
+// time and nothing is allocated: string_view fields point into `input`.
+//
+// Each placeholder extends up to the first occurrence of the literal text that
+// follows it (or to the end of the input for a trailing placeholder). The
+// whole input must match. Fields default to std::string_view; integral fields
+// are parsed with std::from_chars and may carry a leading '+' or '-'.
+//
+// Usage:
+//   auto [from, to, distance] =
+//       *aoc::Scan<"{} to {} = {}", std::string_view, std::string_view, int>(
+//           line);
+//
+// Returns std::nullopt if the input does not match or a field fails to parse.
+template <FixedString kPattern, typename... Ts>
+auto Scan(std::string_view input) {
+  static constexpr auto kLiterals = scan_internal::SplitLiterals<kPattern>();
+  static constexpr size_t kNumFields = kLiterals.size() - 1;
+  static_assert(sizeof...(Ts) == 0 || sizeof...(Ts) == kNumFields,
+                "Scan needs one type per {} in the pattern.");
+
+  using Result = std::conditional_t<
+      sizeof...(Ts) == 0,
+      decltype(std::tuple_cat(std::array<std::string_view, kNumFields>{})),
+      std::tuple<Ts...>>;
+
+  std::optional<Result> result(std::in_place);
+
+  if (!input.starts_with(kLiterals[0])) {
+    return std::optional<Result>();
+  }
+  input.remove_prefix(kLiterals[0].size());
+
+  bool ok = [&]<size_t... I>(std::index_sequence<I...>) {
+    // Fold over the fields in order, stopping at the first failure.
+    return ([&] {
+      constexpr std::string_view kNext = kLiterals[I + 1];
+      size_t end;
+      if constexpr (I + 1 == kNumFields && kNext.empty()) {
+        end = input.size();
+      } else {
+        end = input.find(kNext);
+        if (end == std::string_view::npos) return false;
+      }
+      if (!scan_internal::ParseField(input.substr(0, end),
+                                     std::get<I>(*result))) {
+        return false;
+      }
+      input.remove_prefix(end + kNext.size());
+      return true;
+    }() && ...);
+  }(std::make_index_sequence<kNumFields>());
+
+  if (!ok || !input.empty()) {
+    return std::optional<Result>();
+  }
+  return result;
+}
+
+}  // namespace aoc
@@ -0,0 +1,166 @@
+#include "utils/thread_pool.h"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <utility>
+
+#include "absl/log/check.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
+#include "utils/trace.h"
+
+namespace aoc {
+namespace {
+
+// Set on each worker thread so Schedule() can push onto the caller's own
+// queue.
+thread_local const ThreadPool* current_pool = nullptr;
+thread_local int current_worker = -1;
+
+}  // namespace
+
+ThreadPool::ThreadPool(int num_threads) {
+  CHECK_GT(num_threads, 0);
+  queues_.reserve(num_threads);
+  for (int i = 0; i < num_threads; ++i) {
+    queues_.push_back(std::make_unique<Queue>());
+  }
+  workers_.reserve(num_threads);
+  for (int i = 0; i < num_threads; ++i) {
+    workers_.emplace_back([this, i] { WorkerLoop(i); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    absl::MutexLock lock(&sleep_mu_);
+    stopping_ = true;
+  }
+  wake_.SignalAll();
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+}
+
+void ThreadPool::Schedule(std::function<void()> task) {
+  int index = current_pool == this
+                  ? current_worker
+                  : next_queue_.fetch_add(1, std::memory_order_relaxed) %
+                        queues_.size();
+  // Count the task before it becomes visible so queued_ never goes negative.
+  queued_.fetch_add(1, std::memory_order_release);
+  {
+    Queue& queue = *queues_[index];
+    absl::MutexLock lock(&queue.mu);
+    queue.tasks.push_back(std::move(task));
+  }
+  // Taking the lock orders this with a worker that has just checked queued_
+  // and is about to sleep, so the wakeup can't be lost.
+  { absl::MutexLock lock(&sleep_mu_); }
+  wake_.Signal();
+}
+
+bool ThreadPool::PopOrSteal(int index, std::function<void()>& task) {
+  if (queued_.load(std::memory_order_acquire) == 0) {
+    return false;
+  }
+  if (index >= 0) {
+    Queue& own = *queues_[index];
+    absl::MutexLock lock(&own.mu);
+    if (!own.tasks.empty()) {
+      task = std::move(own.tasks.back());
+      own.tasks.pop_back();
+      queued_.fetch_sub(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  // Steal the oldest task from someone else, starting just past ourselves so
+  // thieves spread out instead of all hitting queue 0.
+  const int n = queues_.size();
+  const int first = index >= 0 ? index + 1 : 0;
+  for (int k = 0; k < n; ++k) {
+    Queue& victim = *queues_[(first + k) % n];
+    absl::MutexLock lock(&victim.mu);
+    if (!victim.tasks.empty()) {
+      task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+      queued_.fetch_sub(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ThreadPool::TryRunOne() {
+  std::function<void()> task;
+  if (!PopOrSteal(current_pool == this ? current_worker : -1, task)) {
+    return false;
+  }
+  AOC_SCOPED_TIMER("pool task");
+  task();
+  return true;
+}
+
+void ThreadPool::WorkerLoop(int index) {
+  current_pool = this;
+  current_worker = index;
+  std::function<void()> task;
+  while (true) {
+    if (PopOrSteal(index, task)) {
+      {
+        AOC_SCOPED_TIMER("pool task");
+        task();
+      }
+      task = nullptr;
+      continue;
+    }
+    absl::MutexLock lock(&sleep_mu_);
+    while (queued_.load(std::memory_order_acquire) == 0 && !stopping_) {
+      wake_.Wait(&sleep_mu_);
+    }
+    if (stopping_ && queued_.load(std::memory_order_acquire) == 0) {
+      return;
+    }
+  }
+}
+
+ThreadPool& DefaultThreadPool() {
+  static ThreadPool* pool =
+      new ThreadPool(std::max(1u, std::thread::hardware_concurrency()));
+  return *pool;
+}
+
+void TaskGroup::Run(std::function<void()> task) {
+  {
+    absl::MutexLock lock(&mu_);
+    ++outstanding_;
+  }
+  pool_.Schedule([this, task = std::move(task)] {
+    task();
+    // Decrement under the lock: once Wait() sees zero it may destroy us, and
+    // it can't get the lock until we are done with it.
+    absl::MutexLock lock(&mu_);
+    --outstanding_;
+  });
+}
+
+void TaskGroup::Wait() {
+  auto done = [this]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    return outstanding_ == 0;
+  };
+  while (true) {
+    {
+      absl::MutexLock lock(&mu_);
+      if (done()) return;
+    }
+    // Help out rather than sit idle. This is also what keeps nested groups
+    // from deadlocking when every worker is waiting.
+    if (pool_.TryRunOne()) continue;
+    absl::MutexLock lock(&mu_);
+    mu_.AwaitWithTimeout(absl::Condition(&done), absl::Milliseconds(1));
+  }
+}
+
+}  // namespace aoc
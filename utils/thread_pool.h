@@ -0,0 +1,181 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+
+namespace aoc {
+
+// A fixed-size, work-stealing thread pool.
+//
+// Every worker owns a deque of tasks. Workers pop their own newest task first
+// (so nested work stays hot in cache) and, when they run dry, steal the oldest
+// task from another worker. Tasks scheduled from outside the pool are spread
+// round-robin across the workers.
+//
+// Most code should not schedule tasks directly; use TaskGroup, ParallelFor or
+// ParallelReduce below.
+class ThreadPool {
+ public:
+  explicit ThreadPool(int num_threads);
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  // Runs every task that is still queued, then joins the workers.
+  ~ThreadPool();
+
+  int NumThreads() const { return workers_.size(); }
+
+  void Schedule(std::function<void()> task);
+
+  // Runs one queued task on the calling thread, if there is one. Returns false
+  // if nothing was queued. Used to help out while waiting on a TaskGroup.
+  bool TryRunOne();
+
+ private:
+  struct Queue {
+    absl::Mutex mu;
+    std::deque<std::function<void()>> tasks ABSL_GUARDED_BY(mu);
+  };
+
+  void WorkerLoop(int index);
+  // Pops from queue `index` if it is >= 0, otherwise steals from any queue.
+  bool PopOrSteal(int index, std::function<void()>& task);
+
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> workers_;
+  std::atomic<uint32_t> next_queue_{0};
+
+  // Tasks that have been scheduled but not yet started.
+  std::atomic<int64_t> queued_{0};
+
+  absl::Mutex sleep_mu_;
+  absl::CondVar wake_;
+  bool stopping_ ABSL_GUARDED_BY(sleep_mu_) = false;
+};
+
+// A pool sized to the machine, created on first use.
+ThreadPool& DefaultThreadPool();
+
+// A set of tasks that can be waited on together. Tasks may themselves create
+// TaskGroups on the same pool; a waiting thread runs queued tasks instead of
+// blocking, so nesting does not deadlock.
+//
+// Usage:
+//   aoc::TaskGroup group(aoc::DefaultThreadPool());
+//   group.Run([&] { left = Solve(a); });
+//   group.Run([&] { right = Solve(b); });
+//   group.Wait();
+class TaskGroup {
+ public:
+  explicit TaskGroup(ThreadPool& pool) : pool_(pool) {}
+  TaskGroup(const TaskGroup&) = delete;
+  TaskGroup& operator=(const TaskGroup&) = delete;
+  ~TaskGroup() { Wait(); }
+
+  void Run(std::function<void()> task);
+
+  // Blocks until every task passed to Run() has finished.
+  void Wait();
+
+ private:
+  ThreadPool& pool_;
+  absl::Mutex mu_;
+  int64_t outstanding_ ABSL_GUARDED_BY(mu_) = 0;
+};
+
+namespace thread_pool_internal {
+
+// Ranges are cut into at most this many chunks unless a grain is given.
+inline constexpr int64_t kDefaultNumChunks = 256;
+
+// The chunk size depends only on the range and the grain, never on the number
+// of threads, so ParallelReduce combines the same partial results in the same
+// order on every machine.
+inline int64_t ChunkSize(int64_t size, int64_t grain) {
+  if (grain > 0) return grain;
+  return std::max<int64_t>(1,
+                           (size + kDefaultNumChunks - 1) / kDefaultNumChunks);
+}
+
+}  // namespace thread_pool_internal
+
+// Calls fn(i) for every i in [begin, end). Iterations are handed out in chunks
+// of `grain` consecutive indices (0 picks a chunk size automatically).
+template <typename F>
+void ParallelFor(ThreadPool& pool, int64_t begin, int64_t end, F fn,
+                 int64_t grain = 0) {
+  if (begin >= end) return;
+  const int64_t chunk = thread_pool_internal::ChunkSize(end - begin, grain);
+  if (pool.NumThreads() <= 1 || end - begin <= chunk) {
+    for (int64_t i = begin; i < end; ++i) fn(i);
+    return;
+  }
+  TaskGroup group(pool);
+  for (int64_t start = begin; start < end; start += chunk) {
+    const int64_t stop = std::min(end, start + chunk);
+    group.Run([&fn, start, stop] {
+      for (int64_t i = start; i < stop; ++i) fn(i);
+    });
+  }
+  group.Wait();
+}
+
+template <typename F>
+void ParallelFor(int64_t begin, int64_t end, F fn) {
+  ParallelFor(DefaultThreadPool(), begin, end, std::move(fn));
+}
+
+// Computes combine(...combine(combine(identity, map(begin)), map(begin + 1))
+// ..., map(end - 1)) in parallel.
+//
+// Each chunk is folded left to right starting from `identity`, and the chunk
+// results are then folded left to right in index order. For a given grain the
+// result is therefore identical from run to run and machine to machine, even
+// when combine is not associative (e.g. floating point addition).
+//
+// Usage:
+//   int64_t total = aoc::ParallelReduce(
+//       0, NumRows(), int64_t{0}, [&](int64_t row) { return CountRow(row); },
+//       std::plus<>());
+template <typename T, typename Map, typename Combine>
+T ParallelReduce(ThreadPool& pool, int64_t begin, int64_t end, T identity,
+                 Map map, Combine combine, int64_t grain = 0) {
+  if (begin >= end) return identity;
+  const int64_t chunk = thread_pool_internal::ChunkSize(end - begin, grain);
+  const int64_t num_chunks = (end - begin + chunk - 1) / chunk;
+  std::vector<T> partials(num_chunks, identity);
+  ParallelFor(
+      pool, 0, num_chunks,
+      [&](int64_t c) {
+        const int64_t start = begin + c * chunk;
+        const int64_t stop = std::min(end, start + chunk);
+        T acc = identity;
+        for (int64_t i = start; i < stop; ++i) {
+          acc = combine(std::move(acc), map(i));
+        }
+        partials[c] = std::move(acc);
+      },
+      /*grain=*/1);
+  T result = std::move(partials.front());
+  for (int64_t c = 1; c < num_chunks; ++c) {
+    result = combine(std::move(result), std::move(partials[c]));
+  }
+  return result;
+}
+
+template <typename T, typename Map, typename Combine>
+T ParallelReduce(int64_t begin, int64_t end, T identity, Map map,
+                 Combine combine) {
+  return ParallelReduce(DefaultThreadPool(), begin, end, std::move(identity),
+                        std::move(map), std::move(combine));
+}
+
+}  // namespace aoc
@@ -0,0 +1,92 @@
+// Measures how ParallelFor and ParallelReduce scale with the number of
+// threads in an aoc::ThreadPool.
+//
+// Usage: bazel run -c opt //utils:thread_pool_benchmark [max_threads]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <print>
+#include <thread>
+#include <vector>
+
+#include "utils/thread_pool.h"
+
+namespace {
+
+constexpr int64_t kNumItems = 1 << 16;
+constexpr int kRepetitions = 5;
+
+// A deliberately CPU-bound, non-vectorizable chunk of work per item.
+uint64_t Work(int64_t item) {
+  uint64_t x = item;
+  for (int i = 0; i < 2000; ++i) {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 29;
+  }
+  return x;
+}
+
+// Keeps the optimizer from throwing away the results.
+uint64_t sink = 0;
+
+template <typename F>
+double BestMs(F run) {
+  double best = 0;
+  for (int rep = 0; rep < kRepetitions; ++rep) {
+    auto start = std::chrono::steady_clock::now();
+    run();
+    auto end = std::chrono::steady_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(end - start).count();
+    best = rep == 0 ? ms : std::min(best, ms);
+  }
+  return best;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int max_threads = argc > 1 ? std::atoi(argv[1])
+                             : std::max(1u, std::thread::hardware_concurrency());
+
+  std::vector<int> thread_counts;
+  for (int n = 1; n < max_threads; n *= 2) {
+    thread_counts.push_back(n);
+  }
+  thread_counts.push_back(max_threads);
+
+  double serial_ms = BestMs([] {
+    for (int64_t i = 0; i < kNumItems; ++i) sink += Work(i);
+  });
+  std::print("{} items, serial loop: {:.2f} ms\n\n", kNumItems, serial_ms);
+
+  std::print("{:>7} {:>10} {:>10} {:>8} {:>10}\n", "threads", "for ms",
+             "reduce ms", "speedup", "efficiency");
+  const uint64_t expected = aoc::ParallelReduce(
+      aoc::DefaultThreadPool(), 0, kNumItems, uint64_t{0}, Work, std::plus<>());
+  for (int threads : thread_counts) {
+    aoc::ThreadPool pool(threads);
+    std::vector<uint64_t> out(kNumItems);
+    double for_ms = BestMs([&] {
+      aoc::ParallelFor(pool, 0, kNumItems,
+                       [&](int64_t i) { out[i] = Work(i); });
+    });
+    uint64_t total = 0;
+    double reduce_ms = BestMs([&] {
+      total = aoc::ParallelReduce(pool, 0, kNumItems, uint64_t{0}, Work,
+                                  std::plus<>());
+    });
+    if (total != expected) {
+      std::print("ParallelReduce mismatch with {} threads!\n", threads);
+      return 1;
+    }
+    sink += out.back() + total;
+    double speedup = serial_ms / reduce_ms;
+    std::print("{:>7} {:>10.2f} {:>10.2f} {:>7.2f}x {:>9.0f}%\n", threads,
+               for_ms, reduce_ms, speedup, 100 * speedup / threads);
+  }
+  return sink == 42 ? 1 : 0;
+}
@@ -0,0 +1,234 @@
+#include "utils/trace.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <print>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/flags/flag.h"
+#include "absl/status/status.h"
+#include "absl/synchronization/mutex.h"
+#include "utils/bench.h"
+
+ABSL_FLAG(std::string, trace_json, "",
+          "Record AOC_SCOPED_TIMER phases, print a summary at exit and write "
+          "a Chrome trace (chrome://tracing, ui.perfetto.dev) to this file.");
+
+namespace aoc {
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// One thread's events. Only the owning thread appends; any thread may read.
+// Events live in fixed-size chunks that are never moved or freed, and each
+// chunk publishes its size with a release store, so a reader sees every event
+// up to that size fully written.
+class ThreadBuffer {
+ public:
+  explicit ThreadBuffer(uint32_t thread_id) : thread_id_(thread_id) {}
+
+  void Append(TraceEvent event) {
+    int size = tail_->size.load(std::memory_order_relaxed);
+    if (size == Chunk::kCapacity) {
+      auto* chunk = new Chunk();
+      tail_->next.store(chunk, std::memory_order_release);
+      tail_ = chunk;
+      size = 0;
+    }
+    event.thread_id = thread_id_;
+    tail_->events[size] = event;
+    tail_->size.store(size + 1, std::memory_order_release);
+  }
+
+  // Appends every published event to `out`.
+  void CollectInto(std::vector<TraceEvent>& out) const {
+    for (const Chunk* chunk = &head_; chunk != nullptr;
+         chunk = chunk->next.load(std::memory_order_acquire)) {
+      int size = chunk->size.load(std::memory_order_acquire);
+      out.insert(out.end(), chunk->events.begin(),
+                 chunk->events.begin() + size);
+    }
+  }
+
+ private:
+  struct Chunk {
+    static constexpr int kCapacity = 1024;
+    std::array<TraceEvent, kCapacity> events;
+    std::atomic<int> size{0};
+    std::atomic<Chunk*> next{nullptr};
+  };
+
+  uint32_t thread_id_;
+  Chunk head_;
+  // Only touched by the owning thread.
+  Chunk* tail_ = &head_;
+};
+
+struct TraceState {
+  absl::Mutex mu;
+  // Buffers outlive their threads so that events from finished threads are
+  // still collected.
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers ABSL_GUARDED_BY(mu);
+};
+
+TraceState& State() {
+  static auto* state = new TraceState();
+  return *state;
+}
+
+std::atomic<int64_t> start_ns{0};
+
+ThreadBuffer& ThisThreadBuffer() {
+  thread_local ThreadBuffer* buffer = [] {
+    TraceState& state = State();
+    absl::MutexLock lock(&state.mu);
+    state.buffers.push_back(
+        std::make_unique<ThreadBuffer>(state.buffers.size()));
+    return state.buffers.back().get();
+  }();
+  return *buffer;
+}
+
+int64_t SinceStart(int64_t ns) {
+  return ns - start_ns.load(std::memory_order_relaxed);
+}
+
+}  // namespace
+
+namespace trace_internal {
+
+int64_t NowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             Clock::now().time_since_epoch())
+      .count();
+}
+
+void Record(const TraceEvent& event) { ThisThreadBuffer().Append(event); }
+
+}  // namespace trace_internal
+
+void StartTracing() {
+  // Claim thread id 0 for the thread that starts the trace.
+  ThisThreadBuffer();
+  start_ns.store(trace_internal::NowNs(), std::memory_order_relaxed);
+  trace_internal::enabled.store(true, std::memory_order_release);
+}
+
+std::vector<TraceEvent> StopTracing() {
+  trace_internal::enabled.store(false, std::memory_order_release);
+  std::vector<TraceEvent> events;
+  {
+    TraceState& state = State();
+    absl::MutexLock lock(&state.mu);
+    for (const auto& buffer : state.buffers) {
+      buffer->CollectInto(events);
+    }
+  }
+  for (TraceEvent& event : events) {
+    event.begin_ns = SinceStart(event.begin_ns);
+    event.end_ns = SinceStart(event.end_ns);
+  }
+  std::sort(events.begin(), events.end(),
+            [](const TraceEvent& a, const TraceEvent& b) {
+              return std::tie(a.thread_id, a.begin_ns, a.depth) <
+                     std::tie(b.thread_id, b.begin_ns, b.depth);
+            });
+  return events;
+}
+
+void PrintTraceSummary(std::span<const TraceEvent> events) {
+  struct Row {
+    std::string_view name;
+    int64_t calls = 0;
+    int64_t total_ns = 0;
+    int64_t max_ns = 0;
+  };
+  std::vector<Row> rows;
+  absl::flat_hash_map<std::string_view, size_t> row_index;
+  int64_t first_ns = std::numeric_limits<int64_t>::max();
+  int64_t last_ns = 0;
+  for (const TraceEvent& event : events) {
+    auto [it, inserted] = row_index.try_emplace(event.name, rows.size());
+    if (inserted) {
+      rows.push_back({.name = event.name});
+    }
+    Row& row = rows[it->second];
+    int64_t ns = event.end_ns - event.begin_ns;
+    ++row.calls;
+    row.total_ns += ns;
+    row.max_ns = std::max(row.max_ns, ns);
+    first_ns = std::min(first_ns, event.begin_ns);
+    last_ns = std::max(last_ns, event.end_ns);
+  }
+  std::sort(rows.begin(), rows.end(), [](const Row& a, const Row& b) {
+    return a.total_ns > b.total_ns;
+  });
+
+  const double wall_ns = events.empty() ? 0 : last_ns - first_ns;
+  std::print("{:<24} {:>8} {:>11} {:>11} {:>11} {:>7}\n", "phase", "calls",
+             "total", "mean", "max", "wall%");
+  for (const Row& row : rows) {
+    const double mean_ns = static_cast<double>(row.total_ns) / row.calls;
+    std::print("{:<24} {:>8} {:>11} {:>11} {:>11} {:>6.1f}%\n", row.name,
+               row.calls, FormatNanoseconds(row.total_ns),
+               FormatNanoseconds(mean_ns), FormatNanoseconds(row.max_ns),
+               wall_ns > 0 ? 100 * row.total_ns / wall_ns : 0.0);
+  }
+}
+
+std::string TraceEventsToJson(std::span<const TraceEvent> events) {
+  std::string json = "{\"traceEvents\": [\n";
+  uint32_t num_threads = 0;
+  for (const TraceEvent& event : events) {
+    num_threads = std::max(num_threads, event.thread_id + 1);
+  }
+  for (uint32_t tid = 0; tid < num_threads; ++tid) {
+    json += std::format(
+        "  {{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, "
+        "\"tid\": {}, \"args\": {{\"name\": \"{}\"}}}},\n",
+        tid, tid == 0 ? std::string("main") : std::format("thread {}", tid));
+  }
+  for (size_t i = 0; i < events.size(); ++i) {
+    const TraceEvent& event = events[i];
+    // Chrome expects microseconds.
+    json += std::format(
+        "  {{\"name\": \"{}\", \"ph\": \"X\", \"pid\": 1, \"tid\": {}, "
+        "\"ts\": {:.3f}, \"dur\": {:.3f}}}{}\n",
+        JsonEscape(event.name), event.thread_id, event.begin_ns / 1e3,
+        (event.end_ns - event.begin_ns) / 1e3,
+        i + 1 < events.size() ? "," : "");
+  }
+  json += "], \"displayTimeUnit\": \"ns\"}\n";
+  return json;
+}
+
+absl::Status FinishTracing(std::string_view json_path) {
+  if (!TracingEnabled()) {
+    return absl::OkStatus();
+  }
+  std::vector<TraceEvent> events = StopTracing();
+  std::print("\n");
+  PrintTraceSummary(events);
+  std::ofstream json{std::string(json_path)};
+  if (!json) {
+    return absl::UnavailableError(
+        std::format("Could not write trace to {}", json_path));
+  }
+  json << TraceEventsToJson(events);
+  return absl::OkStatus();
+}
+
+}  // namespace aoc
@@ -0,0 +1,114 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "absl/flags/declare.h"
+#include "absl/status/status.h"
+
+// Where RunDay and the runner write a Chrome trace of every AOC_SCOPED_TIMER.
+// Tracing is off when empty.
+ABSL_DECLARE_FLAG(std::string, trace_json);
+
+namespace aoc {
+
+// Phase tracing for finding where a day spends its time.
+//
+// Usage:
+//   int64_t Part1(const Input& input) {
+//     AOC_SCOPED_TIMER("part1");
+//     ...
+//   }
+//
+// Each timer records its enclosing scope, on the calling thread, as one
+// event. Timers nest, and every thread appends to its own buffer without
+// locking, so timers are safe inside ParallelFor bodies. Until StartTracing()
+// is called a timer costs one relaxed atomic load.
+//
+// RunDay and //runner:aoc_runner already time each day's parse, parts and
+// output; run either with --trace_json=/tmp/trace.json and open the file in
+// chrome://tracing or https://ui.perfetto.dev.
+struct TraceEvent {
+  // Must outlive the trace; usually a string literal.
+  std::string_view name;
+  // Nanoseconds since StartTracing().
+  int64_t begin_ns = 0;
+  int64_t end_ns = 0;
+  // Small per-thread id, in the order threads first recorded an event.
+  uint32_t thread_id = 0;
+  // Number of enclosing timers on the same thread.
+  uint32_t depth = 0;
+};
+
+namespace trace_internal {
+
+inline std::atomic<bool> enabled{false};
+inline thread_local uint32_t depth = 0;
+
+int64_t NowNs();
+void Record(const TraceEvent& event);
+
+}  // namespace trace_internal
+
+inline bool TracingEnabled() {
+  return trace_internal::enabled.load(std::memory_order_relaxed);
+}
+
+// Starts recording events. The calling thread is thread 0 in the trace. Call
+// at most once per process.
+void StartTracing();
+
+// Stops recording and returns every event recorded so far, ordered by thread
+// and then by start time. Timers still open on other threads are dropped.
+std::vector<TraceEvent> StopTracing();
+
+// Records the lifetime of the object as an event named `name`, which must
+// outlive the trace. Prefer AOC_SCOPED_TIMER.
+class ScopedTimer {
+ public:
+  explicit ScopedTimer(std::string_view name) : name_(name) {
+    if (TracingEnabled()) {
+      begin_ns_ = trace_internal::NowNs();
+      ++trace_internal::depth;
+    }
+  }
+  ScopedTimer(const ScopedTimer&) = delete;
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+  ~ScopedTimer() {
+    if (begin_ns_ < 0) return;
+    --trace_internal::depth;
+    trace_internal::Record({.name = name_,
+                            .begin_ns = begin_ns_,
+                            .end_ns = trace_internal::NowNs(),
+                            .depth = trace_internal::depth});
+  }
+
+ private:
+  std::string_view name_;
+  // -1 if tracing was off when the timer started.
+  int64_t begin_ns_ = -1;
+};
+
+#define AOC_TRACE_CONCAT_INNER(a, b) a##b
+#define AOC_TRACE_CONCAT(a, b) AOC_TRACE_CONCAT_INNER(a, b)
+#define AOC_SCOPED_TIMER(name) \
+  ::aoc::ScopedTimer AOC_TRACE_CONCAT(aoc_scoped_timer_, __LINE__)(name)
+
+// Prints one row per event name: calls, total, mean and max time, and the
+// share of the traced wall time. Nested events count toward their parents too.
+void PrintTraceSummary(std::span<const TraceEvent> events);
+
+// Serializes events in Chrome's trace event format ("X" complete events, plus
+// a name for each thread).
+std::string TraceEventsToJson(std::span<const TraceEvent> events);
+
+// Stops tracing, prints the summary and writes the JSON to `json_path`. Does
+// nothing if tracing is off.
+absl::Status FinishTracing(std::string_view json_path);
+
+}  // namespace aoc
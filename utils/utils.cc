@@ -1,10 +1,12 @@
+#include "utils/utils.h"
+
 #include <algorithm>
 #include <cassert>
 #include <cctype>
 #include <charconv>
 #include <fstream>
 #include <ios>
-#include <iostream>
+#include <memory_resource>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -51,7 +53,7 @@ std::vector<std::string> LoadStringsFromFileByLine(
   std::ifstream file;
   file.open(file_path, std::ios::in);
   if (!file.is_open()) {
-    std::cout << "Failed to open file " << file_path << "\n";
+    AOC_LOG(ERROR, "Failed to open file {}", file_path);
     return {};
   }
   std::string str;
@@ -61,8 +63,54 @@ std::vector<std::string> LoadStringsFromFileByLine(
   }
   return str_vector;
 }
-// Helper function to trim leading and trailing whitespace from a string_view.
-std::string_view Trim(std::string_view str) {
+
+std::pmr::vector<std::pmr::string> LoadStringsFromFileByLine(
+    const std::string& file_path, std::pmr::memory_resource* resource) {
+  std::pmr::vector<std::pmr::string> str_vector(resource);
+  std::ifstream file;
+  file.open(file_path, std::ios::in);
+  if (!file.is_open()) {
+    AOC_LOG(ERROR, "Failed to open file {}", file_path);
+    return str_vector;
+  }
+  // Read each line into a reused buffer so the only arena allocations are the
+  // final strings.
+  std::string str;
+  while (std::getline(file, str)) {
+    str_vector.emplace_back(str);
+  }
+  return str_vector;
+}
+
+std::vector<std::string> SplitLines(std::string_view input) {
+  std::vector<std::string> lines;
+  while (!input.empty()) {
+    size_t end = input.find('\n');
+    lines.emplace_back(input.substr(0, end));
+    if (end == std::string_view::npos) {
+      break;
+    }
+    input.remove_prefix(end + 1);
+  }
+  return lines;
+}
+
+std::pmr::vector<std::pmr::string> SplitLines(
+    std::string_view input, std::pmr::memory_resource* resource) {
+  std::pmr::vector<std::pmr::string> lines(resource);
+  while (!input.empty()) {
+    size_t end = input.find('\n');
+    lines.emplace_back(input.substr(0, end));
+    if (end == std::string_view::npos) {
+      break;
+    }
+    input.remove_prefix(end + 1);
+  }
+  return lines;
+}
+
+// Trim leading and trailing whitespace from a string_view.
+std::string_view TrimWhitespace(std::string_view str) {
   auto start = std::find_if_not(str.begin(), str.end(), [](unsigned char ch) {
     return std::isspace(ch);
   });
@@ -78,47 +126,65 @@ std::string_view Trim(std::string_view str) {
   return std::string_view(&(*start), std::distance(start, end));
 }
 
-// Splits a delimited string into a vector of trimmed substrings.
-std::vector<std::string> SplitDelimitedString(std::string_view input,
-                                              std::string_view delimiter = "") {
-  std::vector<std::string> result;
+void SplitView::Iterator::Advance() {
+  static constexpr std::string_view kWhitespace = " \t\n\r";
 
-  if (delimiter.empty()) {
+  if (delimiter_.empty()) {
     // Split by whitespace when delimiter is empty.
-    size_t start = 0;
-    while (start < input.size()) {
-      // Find the start of the next word.
-      start = input.find_first_not_of(" \t\n\r", start);
-      if (start == std::string_view::npos) {
-        break;
-      }
-
-      // Find the end of the current word.
-      size_t end = input.find_first_of(" \t\n\r", start);
-      result.emplace_back(std::string(Trim(input.substr(start, end - start))));
-
-      // Move to the next part of the string.
-      start = end;
+    // Find the start of the next word.
+    size_t start = rest_.find_first_not_of(kWhitespace);
+    if (start == std::string_view::npos) {
+      done_ = true;
+      return;
     }
-  } else {
-    // Split by the specified delimiter.
-    while (!input.empty()) {
-      size_t pos = input.find(delimiter);
 
-      // Extract the substring before the delimiter.
-      std::string_view token = input.substr(0, pos);
-      result.emplace_back(std::string(Trim(token)));
+    // Find the end of the current word.
+    size_t end = rest_.find_first_of(kWhitespace, start);
+    token_ = TrimWhitespace(rest_.substr(start, end - start));
+
+    // Move to the next part of the string.
+    rest_ = end == std::string_view::npos ? std::string_view()
+                                          : rest_.substr(end);
+    return;
+  }
 
-      // If no delimiter was found, we're done.
-      if (pos == std::string_view::npos) {
-        break;
-      }
+  // Split by the specified delimiter.
+  if (last_token_ || rest_.empty()) {
+    done_ = true;
+    return;
+  }
+  size_t pos = rest_.find(delimiter_);
 
-      // Move to the substring after the delimiter.
-      input.remove_prefix(pos + delimiter.size());
-    }
+  // Extract the substring before the delimiter.
+  token_ = TrimWhitespace(rest_.substr(0, pos));
+
+  // If no delimiter was found, this is the last token.
+  if (pos == std::string_view::npos) {
+    last_token_ = true;
+    return;
   }
 
+  // Move to the substring after the delimiter.
+  rest_.remove_prefix(pos + delimiter_.size());
+}
+
+// Splits a delimited string into a vector of trimmed substrings.
+std::vector<std::string> SplitDelimitedString(std::string_view input,
+                                              std::string_view delimiter) {
+  std::vector<std::string> result;
+  for (std::string_view token : Split(input, delimiter)) {
+    result.emplace_back(token);
+  }
+  return result;
+}
+
+std::pmr::vector<std::pmr::string> SplitDelimitedString(
+    std::string_view input, std::string_view delimiter,
+    std::pmr::memory_resource* resource) {
+  std::pmr::vector<std::pmr::string> result(resource);
+  for (std::string_view token : Split(input, delimiter)) {
+    result.emplace_back(token);
+  }
   return result;
 }
 
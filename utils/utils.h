@@ -1,10 +1,18 @@
 #pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
 #include <format>
+#include <iterator>
+#include <memory_resource>
 #include <numeric>
 #include <print>
-#include <regex>
+#include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "absl/status/statusor.h"
@@ -21,6 +29,34 @@ enum class Direction {
 // Quick macro to print a variable when debugging.
 // Usage: PRINT(foo);
 #define PRINT(var) std::print(#var ": {}\n", var)
+
+// Log levels for AOC_LOG, from most to least severe.
+#define AOC_LOG_LEVEL_ERROR 0
+#define AOC_LOG_LEVEL_INFO 1
+#define AOC_LOG_LEVEL_DEBUG 2
+#define AOC_LOG_LEVEL_TRACE 3
+
+// The most verbose level AOC_LOG prints. Raise it to debug a day, e.g.
+// bazel run //2024:day6 --copt=-DAOC_LOG_LEVEL=AOC_LOG_LEVEL_TRACE
+#ifndef AOC_LOG_LEVEL
+#define AOC_LOG_LEVEL AOC_LOG_LEVEL_INFO
+#endif
+
+// True if AOC_LOG prints at `level` (ERROR, INFO, DEBUG or TRACE). Usable in
+// `if constexpr` to skip whole blocks of diagnostics.
+#define AOC_LOG_ENABLED(level) (AOC_LOG_LEVEL_##level <= AOC_LOG_LEVEL)
+
+// Prints a line to stderr if `level` is enabled. Disabled levels compile to
+// nothing: the arguments are type-checked but never evaluated, so it is safe
+// to use in hot loops.
+// Usage: AOC_LOG(DEBUG, "Step {} at {}", step, c.ToString());
+#define AOC_LOG(level, ...)                 \
+  do {                                      \
+    if constexpr (AOC_LOG_ENABLED(level)) { \
+      std::println(stderr, __VA_ARGS__);    \
+    }                                       \
+  } while (false)
+
 // // Hashable, equality comparable Coordinate.
 // // This coordinate denotes rows and columns rather than x and y. The meaning
 // of
@@ -69,22 +105,182 @@ H AbslHashValue(H h, const Coordinate& m) {
   return H::combine(std::move(h), m.row, m.col);
 }
 
+// A Coordinate packed into a single 64-bit key: the row in the high 32 bits
+// and the column in the low 32 bits. Both must fit in an int32_t.
+//
+// Coordinate is 16 bytes (an int next to an int64_t) and hashing it combines
+// two fields. A CoordKey is 8 bytes and hashes as one integer, which makes it
+// the cheaper key for hash sets and maps of grid positions.
+struct CoordKey {
+  uint64_t packed{0};
+
+  static CoordKey From(Coordinate c) {
+    return {(static_cast<uint64_t>(static_cast<uint32_t>(c.row)) << 32) |
+            static_cast<uint32_t>(c.col)};
+  }
+
+  Coordinate ToCoordinate() const {
+    return {static_cast<int32_t>(packed >> 32),
+            static_cast<int32_t>(packed & 0xFFFFFFFF)};
+  }
+
+  bool operator==(const CoordKey& other) const = default;
+
+  template <typename H>
+  friend H AbslHashValue(H h, const CoordKey& k) {
+    return H::combine(std::move(h), k.packed);
+  }
+};
+
+// Hash functor for CoordKey (MurmurHash3's 64-bit finalizer). Neighboring
+// cells differ in only a few low bits, so the key must be mixed before it is
+// used to pick a bucket.
+struct CoordKeyHash {
+  size_t operator()(CoordKey k) const {
+    uint64_t x = k.packed;
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ULL;
+    x ^= x >> 33;
+    return static_cast<size_t>(x);
+  }
+};
+
 // Convert a char to an int64_t. WARNING: No error checking.
 int64_t ConvertCharToInt(char c);
 
+// A rectangular grid of T stored in a single row-major allocation.
+//
+// Cell (row, col) lives at data[(row + border) * stride + (col + border)],
+// where stride = cols + 2 * border. Every row is contiguous, so scanning a row
+// or stepping to a neighbor is a pointer offset rather than a second heap
+// lookup like it is with std::vector<std::vector<T>>.
+//
+// The optional sentinel border is a ring of `border` cells around the grid that
+// is filled with `border_fill`. Reading a neighbor up to `border` cells outside
+// the grid is always safe and returns the sentinel, so hot loops can skip their
+// bounds checks. IsOutOfBounds() still only considers the interior.
+template <typename T>
+class Grid {
+  // std::vector<bool> is bit packed and hands out proxies instead of T&. Use
+  // uint8_t (or char) for boolean grids.
+  static_assert(!std::is_same_v<T, bool>, "Use Grid<uint8_t> instead.");
+
+ public:
+  Grid() = default;
+
+  Grid(int64_t rows, int64_t cols, const T& fill = T{}, int64_t border = 0,
+       const T& border_fill = T{})
+      : rows_(rows),
+        cols_(cols),
+        border_(border),
+        stride_(cols + 2 * border),
+        data_((rows + 2 * border) * (cols + 2 * border), border_fill) {
+    Fill(fill);
+  }
+
+  // Builds a grid from a container of strings (or string_views), one row per
+  // element. All rows must have the same length as the first.
+  template <typename Lines>
+  static Grid FromLines(const Lines& lines, int64_t border = 0,
+                        const T& border_fill = T{}) {
+    int64_t rows = std::size(lines);
+    int64_t cols = rows > 0 ? std::size(*std::begin(lines)) : 0;
+    Grid grid(rows, cols, T{}, border, border_fill);
+    int64_t row = 0;
+    for (std::string_view line : lines) {
+      std::copy_n(line.begin(), std::min<int64_t>(cols, line.size()),
+                  grid.Row(row).begin());
+      ++row;
+    }
+    return grid;
+  }
+
+  bool operator==(const Grid& other) const = default;
+
+  int64_t NumRows() const { return rows_; }
+  int64_t NumCols() const { return cols_; }
+  int64_t Border() const { return border_; }
+  // Distance in elements between vertically adjacent cells.
+  int64_t Stride() const { return stride_; }
+
+  bool IsOutOfBounds(Coordinate c) const {
+    return c.row < 0 || c.row >= rows_ || c.col < 0 || c.col >= cols_;
+  }
+
+  // No bounds checking beyond the sentinel border.
+  T& operator[](Coordinate c) { return data_[Index(c)]; }
+  const T& operator[](Coordinate c) const { return data_[Index(c)]; }
+
+  // Flat index of the cell, for callers that want to walk the storage with
+  // +/-1 and +/-Stride() offsets.
+  int64_t Index(Coordinate c) const {
+    return (c.row + border_) * stride_ + (c.col + border_);
+  }
+  T* data() { return data_.data(); }
+  const T* data() const { return data_.data(); }
+
+  // The interior cells of a single row.
+  std::span<T> Row(int64_t row) {
+    return {data_.data() + Index({static_cast<int>(row), 0}),
+            static_cast<size_t>(cols_)};
+  }
+  std::span<const T> Row(int64_t row) const {
+    return {data_.data() + Index({static_cast<int>(row), 0}),
+            static_cast<size_t>(cols_)};
+  }
+
+  // Sets every interior cell to `value`. The border is left untouched.
+  void Fill(const T& value) {
+    if (border_ == 0) {
+      std::fill(data_.begin(), data_.end(), value);
+      return;
+    }
+    for (int64_t row = 0; row < rows_; ++row) {
+      std::span<T> r = Row(row);
+      std::fill(r.begin(), r.end(), value);
+    }
+  }
+
+  // Counts the interior cells equal to `value`.
+  int64_t Count(const T& value) const {
+    int64_t count = 0;
+    for (int64_t row = 0; row < rows_; ++row) {
+      std::span<const T> r = Row(row);
+      count += std::count(r.begin(), r.end(), value);
+    }
+    return count;
+  }
+
+  void swap(Grid& other) noexcept {
+    std::swap(rows_, other.rows_);
+    std::swap(cols_, other.cols_);
+    std::swap(border_, other.border_);
+    std::swap(stride_, other.stride_);
+    data_.swap(other.data_);
+  }
+
+ private:
+  int64_t rows_ = 0;
+  int64_t cols_ = 0;
+  int64_t border_ = 0;
+  int64_t stride_ = 0;
+  std::vector<T> data_;
+};
+
 class VisitedMap {
  public:
   // Constructor to initialize the map with given dimensions.
   // Defaults to all cells unvisited (false).
-  VisitedMap(int rows, int cols)
-      : visited_(rows, std::vector<bool>(cols, false)) {}
+  VisitedMap(int rows, int cols) : visited_(rows, cols, 0) {}
 
   // Marks a cell as visited.
   bool MarkVisited(Coordinate c) {
     if (IsOutOfBounds(c)) {
       return false;
     }
-    visited_[c.row][c.col] = true;
+    visited_[c] = 1;
     return true;
   }
 
@@ -93,7 +289,7 @@ class VisitedMap {
     if (IsOutOfBounds(c)) {
       return false;
     }
-    visited_[c.row][c.col] = false;
+    visited_[c] = 0;
     return true;
   }
 
@@ -102,68 +298,127 @@ class VisitedMap {
     if (IsOutOfBounds(c)) {
       return false;
     }
-    return visited_[c.row][c.col];
+    return visited_[c] != 0;
+  }
+
+  // Resets the entire map to unvisited.
+  void Reset() { visited_.Fill(0); }
+
+  // Gets the number of rows in the map.
+  int NumRows() const { return static_cast<int>(visited_.NumRows()); }
+
+  // Gets the number of columns in the map.
+  int NumCols() const { return static_cast<int>(visited_.NumCols()); }
+
+  // Checks if the given cell is out of bounds.
+  bool IsOutOfBounds(Coordinate c) const { return visited_.IsOutOfBounds(c); }
+
+ private:
+  Grid<uint8_t> visited_;  // 2D grid to store visitation states.
+};
+
+// Drop-in replacement for VisitedMap for code that clears the map between
+// many searches (one flood fill per candidate, one simulation per obstacle,
+// ...).
+//
+// Each cell stores the epoch it was last visited in, and a cell is visited iff
+// its stamp equals the current epoch. Reset() just advances the epoch, so it is
+// O(1) instead of O(rows * cols). The stamps are only cleared when the epoch
+// counter wraps around.
+class EpochVisitedMap {
+ public:
+  EpochVisitedMap(int rows, int cols) : stamps_(rows, cols, kNeverVisited) {}
+
+  // Marks a cell as visited.
+  bool MarkVisited(Coordinate c) {
+    if (IsOutOfBounds(c)) {
+      return false;
+    }
+    stamps_[c] = epoch_;
+    return true;
+  }
+
+  // Marks a cell as unvisited.
+  bool MarkUnvisited(Coordinate c) {
+    if (IsOutOfBounds(c)) {
+      return false;
+    }
+    stamps_[c] = kNeverVisited;
+    return true;
+  }
+
+  // Checks if a cell has been visited since the last Reset().
+  bool IsVisited(Coordinate c) const {
+    if (IsOutOfBounds(c)) {
+      return false;
+    }
+    return stamps_[c] == epoch_;
   }
 
   // Resets the entire map to unvisited.
   void Reset() {
-    for (auto& row : visited_) {
-      std::fill(row.begin(), row.end(), false);
+    if (++epoch_ == kNeverVisited) {
+      // Wrapped around. Old stamps could now collide with new epochs.
+      stamps_.Fill(kNeverVisited);
+      epoch_ = kNeverVisited + 1;
     }
   }
 
   // Gets the number of rows in the map.
-  int NumRows() const { return static_cast<int>(visited_.size()); }
+  int NumRows() const { return static_cast<int>(stamps_.NumRows()); }
 
   // Gets the number of columns in the map.
-  int NumCols() const {
-    return NumRows() > 0 ? static_cast<int>(visited_[0].size()) : 0;
-  }
+  int NumCols() const { return static_cast<int>(stamps_.NumCols()); }
 
   // Checks if the given cell is out of bounds.
-  bool IsOutOfBounds(Coordinate c) const {
-    return c.row < 0 || c.row >= NumRows() || c.col < 0 || c.col >= NumCols();
-  }
+  bool IsOutOfBounds(Coordinate c) const { return stamps_.IsOutOfBounds(c); }
 
  private:
-  std::vector<std::vector<bool>>
-      visited_;  // 2D grid to store visitation states.
+  static constexpr uint32_t kNeverVisited = 0;
+
+  Grid<uint32_t> stamps_;
+  uint32_t epoch_ = kNeverVisited + 1;
 };
 
-// A rectangular grid of strings, with some helper functions.
+// A rectangular grid of chars, with some helper functions.
+// The map is surrounded by a one cell border of kOutside, so GetChar() on any
+// direct or diagonal neighbor of an in-bounds cell is safe.
 class Map {
  public:
-  explicit Map(std::vector<std::string> map) : map_(std::move(map)) {}
+  static constexpr char kOutside = '\0';
+
+  explicit Map(const std::vector<std::string>& map)
+      : map_(Grid<char>::FromLines(map, /*border=*/1, kOutside)) {}
+  explicit Map(const std::vector<std::string_view>& map)
+      : map_(Grid<char>::FromLines(map, /*border=*/1, kOutside)) {}
 
   void Print() {
     std::print("\n");
-    for (std::string_view row : map_) {
-      std::print("{}\n", row);
+    for (int64_t row = 0; row < NumRows(); ++row) {
+      std::span<const char> r = map_.Row(row);
+      std::print("{}\n", std::string_view(r.data(), r.size()));
     }
     std::print("\n");
   }
 
-  bool IsOutOfBounds(Coordinate c) const {
-    bool in_bounds =
-        c.row >= 0 && c.row < NumRows() && c.col >= 0 && c.col < NumCols();
-
-    return !in_bounds;
-  }
+  bool IsOutOfBounds(Coordinate c) const { return map_.IsOutOfBounds(c); }
 
-  char GetChar(Coordinate c) const { return map_[c.row][c.col]; }
-  void SetChar(Coordinate c, char val) { map_[c.row][c.col] = val; }
+  char GetChar(Coordinate c) const { return map_[c]; }
+  void SetChar(Coordinate c, char val) { map_[c] = val; }
   bool CharEquals(Coordinate c, char val) const {
-    return !IsOutOfBounds(c) && map_[c.row][c.col] == val;
+    return !IsOutOfBounds(c) && map_[c] == val;
   }
   // Only do this if the char is an int64_t.
   int64_t GetInt(Coordinate c) const {
     return ::aoc::ConvertCharToInt(GetChar(c));
   }
-  int64_t NumRows() const { return map_.size(); }
-  int64_t NumCols() const { return map_.front().size(); }
+  int64_t NumRows() const { return map_.NumRows(); }
+  int64_t NumCols() const { return map_.NumCols(); }
+
+  const Grid<char>& grid() const { return map_; }
 
  private:
-  std::vector<std::string> map_;
+  Grid<char> map_;
 };
 
 // Trait to detect if a type is a container
@@ -255,38 +510,99 @@ void StripWhitespace(std::vector<std::string>& vec);
 // Read the file by file path into a std::string.
 std::string ReadFileToString(const std::string& file_path);
 
-// Utility function to parse input data based on a given regex pattern and
-// processing function.
-template <typename T>
-std::vector<T> ParseDataWithRegex(
-    const std::vector<std::string>& lines, const std::regex& pattern,
-    std::function<T(const std::vector<std::string>&)> ProcessMatchFunction) {
-  std::vector<T> results;
-
-  for (const auto& line : lines) {
-    std::smatch matches;
-    if (std::regex_search(line, matches, pattern)) {
-      // Extract all matches except the first one.
-      std::vector<std::string> captured_groups;
-      for (size_t i = 1; i < matches.size(); ++i) {
-        captured_groups.push_back(matches[i].str());
-      }
-      // Process the captured groups
-      results.push_back(ProcessMatchFunction(captured_groups));
-    }
-  }
-
-  return results;
-};
-
 // Read the file by file path, returning each line as a std::string in a
 // std::vector.
 std::vector<std::string> LoadStringsFromFileByLine(
     const std::string& file_path);
 
+// Same, but the vector and every line are allocated from `resource` (usually
+// an aoc::Arena).
+std::pmr::vector<std::pmr::string> LoadStringsFromFileByLine(
+    const std::string& file_path, std::pmr::memory_resource* resource);
+
+// Splits an in-memory input into the same lines LoadStringsFromFileByLine()
+// would return for a file with those contents: no newlines, no trimming, and
+// no empty line for a trailing '\n'.
+std::vector<std::string> SplitLines(std::string_view input);
+
+// Same, but the vector and every line are allocated from `resource`.
+std::pmr::vector<std::pmr::string> SplitLines(
+    std::string_view input, std::pmr::memory_resource* resource);
+
+// A lazy range over the trimmed tokens of a delimited string. Nothing is
+// copied or allocated; every token is a std::string_view into `input`.
+//
+// With an empty delimiter the input is split on runs of whitespace. Otherwise
+// it is split on every occurrence of `delimiter`, and empty tokens between
+// adjacent delimiters are kept.
+//
+// Usage:
+//   for (std::string_view token : aoc::Split("R4, R3, L5", ",")) { ... }
+class SplitView {
+ public:
+  class Iterator {
+   public:
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+
+    Iterator() = default;
+
+    std::string_view operator*() const { return token_; }
+    Iterator& operator++() {
+      Advance();
+      return *this;
+    }
+    void operator++(int) { Advance(); }
+
+    friend bool operator==(const Iterator& it, std::default_sentinel_t) {
+      return it.done_;
+    }
+
+   private:
+    friend class SplitView;
+
+    Iterator(std::string_view input, std::string_view delimiter)
+        : rest_(input), delimiter_(delimiter) {
+      Advance();
+    }
+
+    // Moves to the next token, or marks the iterator done.
+    void Advance();
+
+    std::string_view rest_;
+    std::string_view delimiter_;
+    std::string_view token_;
+    // Set once the final delimited token has been produced.
+    bool last_token_ = false;
+    bool done_ = false;
+  };
+
+  explicit SplitView(std::string_view input, std::string_view delimiter = "")
+      : input_(input), delimiter_(delimiter) {}
+
+  Iterator begin() const { return Iterator(input_, delimiter_); }
+  std::default_sentinel_t end() const { return {}; }
+
+ private:
+  std::string_view input_;
+  std::string_view delimiter_;
+};
+
+inline SplitView Split(std::string_view input,
+                       std::string_view delimiter = "") {
+  return SplitView(input, delimiter);
+}
+
+// Splits a delimited string into a vector of trimmed substrings. Same tokens as
+// Split(), but copied into owned strings.
 std::vector<std::string> SplitDelimitedString(std::string_view input,
                                               std::string_view delimiter = "");
 
+// Same, but the vector and every token are allocated from `resource`.
+std::pmr::vector<std::pmr::string> SplitDelimitedString(
+    std::string_view input, std::string_view delimiter,
+    std::pmr::memory_resource* resource);
+
 // Converts an input string into an integer or returns a failing status.
 absl::StatusOr<int64_t> ConvertStringViewToInt64(std::string_view input);
 